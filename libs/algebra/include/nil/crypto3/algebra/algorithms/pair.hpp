@@ -26,11 +26,24 @@
 #ifndef CRYPTO3_ALGEBRA_PAIRING_ALGORITHM_HPP
 #define CRYPTO3_ALGEBRA_PAIRING_ALGORITHM_HPP
 
+#include <type_traits>
+#include <vector>
+
+#include <boost/assert.hpp>
+
 #include <nil/crypto3/algebra/pairing/pairing_policy.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace algebra {
+            namespace detail {
+                template<typename PairingPolicy, typename = void>
+                struct has_multi_miller_loop : std::false_type { };
+
+                template<typename PairingPolicy>
+                struct has_multi_miller_loop<PairingPolicy, std::void_t<typename PairingPolicy::multi_miller_loop>>
+                    : std::true_type { };
+            }    // namespace detail
 
             // template<typename PairingCurveType>
             // typename PairingCurveType::pairing::affine_ate_g1_precomp
@@ -124,6 +137,52 @@ namespace nil {
 
                 return PairingPolicy::miller_loop::process(prec_P, prec_Q);
             }
+
+            /**
+             * Product of the Miller loops of prec_P[i] and prec_Q[i]. Policies with a multi_miller_loop share
+             * the squarings between the pairs, the rest multiply the separate loops.
+             */
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
+            typename PairingCurveType::gt_type::value_type
+                multi_miller_loop(const std::vector<typename PairingPolicy::g1_precomputed_type> &prec_P,
+                                  const std::vector<typename PairingPolicy::g2_precomputed_type> &prec_Q) {
+                BOOST_ASSERT(prec_P.size() == prec_Q.size());
+
+                if constexpr (detail::has_multi_miller_loop<PairingPolicy>::value) {
+                    return PairingPolicy::multi_miller_loop::process(prec_P, prec_Q);
+                } else {
+                    typename PairingCurveType::gt_type::value_type f =
+                        PairingCurveType::gt_type::value_type::one();
+                    for (std::size_t i = 0; i < prec_P.size(); ++i) {
+                        f = f * PairingPolicy::miller_loop::process(prec_P[i], prec_Q[i]);
+                    }
+                    return f;
+                }
+            }
+
+            /**
+             * Product of the reduced pairings of P[i] and Q[i], computed with one Miller loop and a single final
+             * exponentiation. Checks like e(A, B) == e(C, D) are cheapest as multi_pair_reduced({A, -C}, {B, D})
+             * being one.
+             */
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
+            typename PairingCurveType::gt_type::value_type
+                multi_pair_reduced(const std::vector<typename PairingCurveType::template g1_type<>::value_type> &P,
+                                   const std::vector<typename PairingCurveType::template g2_type<>::value_type> &Q) {
+                BOOST_ASSERT(P.size() == Q.size());
+
+                std::vector<typename PairingPolicy::g1_precomputed_type> prec_P;
+                std::vector<typename PairingPolicy::g2_precomputed_type> prec_Q;
+                prec_P.reserve(P.size());
+                prec_Q.reserve(Q.size());
+                for (std::size_t i = 0; i < P.size(); ++i) {
+                    prec_P.emplace_back(PairingPolicy::precompute_g1::process(P[i]));
+                    prec_Q.emplace_back(PairingPolicy::precompute_g2::process(Q[i]));
+                }
+
+                return PairingPolicy::final_exponentiation::process(
+                    multi_miller_loop<PairingCurveType, PairingPolicy>(prec_P, prec_Q));
+            }
         }    // namespace algebra
     }        // namespace crypto3
 }    // namespace nil
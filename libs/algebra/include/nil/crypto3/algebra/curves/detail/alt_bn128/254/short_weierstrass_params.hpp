@@ -70,6 +70,20 @@ namespace nil {
 
                         constexpr static const std::array<typename field_type::value_type, 2> one_fill = {
                             field_type::value_type::one(), typename field_type::value_type(0x02u)};
+
+                        /// (x, y) -> (glv_beta * x, y) acts on the subgroup as multiplication by glv_lambda, see glv.hpp
+                        constexpr static const typename field_type::value_type glv_beta =
+                            typename field_type::value_type(0x59e26bcea0d48bacd4f263f1acdb5c4f5763473177fffffe_cppui_modular254);
+                        constexpr static const typename scalar_field_type::integral_type glv_lambda =
+                            0xb3c4d79d41a917585bfc41088d8daaa78b17ea66b99c90dd_cppui_modular254;
+                        constexpr static const std::array<typename scalar_field_type::integral_type, 4> glv_basis = {
+                            0x89d3256894d213e3_cppui_modular254, 0x6f4d8248eeb859fc8211bbeb7d4f1128_cppui_modular254,
+                            0x6f4d8248eeb859fd0be4e1541221250b_cppui_modular254, 0x89d3256894d213e3_cppui_modular254};
+                        constexpr static const std::array<typename scalar_field_type::integral_type, 2> glv_round = {
+                            0xb64748cbb1f82cf6_cppui_modular254, 0x9333bc0529dcf4b3de9ef6750e47ac63_cppui_modular254};
+
+                        /// E(F_p) has prime order, every point of the curve is in the group
+                        constexpr static const bool cofactor_is_one = true;
                     };
 
                     template<>
@@ -102,6 +116,19 @@ namespace nil {
                             typename field_type::value_type(
                                 0x12C85EA5DB8C6DEB4AAB71808DCB408FE3D1E7690C43D37B4CE6CC0166FA7DAA_cppui_modular254,
                                 0x90689D0585FF075EC9E99AD690C3395BC4B313370B38EF355ACDADCD122975B_cppui_modular254)};
+
+                        /// psi(x, y) = (psi_coeff_x * conj(x), psi_coeff_y * conj(y)) acts on the subgroup as
+                        /// multiplication by 6z^2, see subgroup_check.hpp
+                        constexpr static const typename field_type::value_type psi_coeff_x = typename field_type::value_type(
+                            0x2fb347984f7911f74c0bec3cf559b143b78cc310c2c3330c99e39557176f553d_cppui_modular254,
+                            0x16c9e55061ebae204ba4cc8bd75a079432ae2a1d0b7c9dce1665d51c640fcba2_cppui_modular254);
+                        constexpr static const typename field_type::value_type psi_coeff_y = typename field_type::value_type(
+                            0x63cf305489af5dcdc5ec698b6e2f9b9dbaae0eda9c95998dc54014671a0135a_cppui_modular254,
+                            0x7c03cbcac41049a0704b5a7ec796f2b21807dc98fa25bd282d37f632623b0e3_cppui_modular254);
+                        constexpr static const typename scalar_field_type::integral_type subgroup_check_scalar =
+                            0x6f4d8248eeb859fbf83e9682e87cfd46_cppui_modular254;
+                        constexpr static const bool subgroup_check_scalar_negative = false;
+                        constexpr static const std::size_t cofactor_min_prime = 10069;    ///< smallest prime factor of the cofactor
                     };
 
                     constexpr typename alt_bn128_types<254>::integral_type const
@@ -115,6 +142,17 @@ namespace nil {
                     constexpr std::array<
                         typename alt_bn128_g1_params<254, forms::short_weierstrass>::field_type::value_type,
                         2> const alt_bn128_g1_params<254, forms::short_weierstrass>::one_fill;
+
+                    constexpr typename alt_bn128_g1_params<254, forms::short_weierstrass>::field_type::value_type const
+                        alt_bn128_g1_params<254, forms::short_weierstrass>::glv_beta;
+                    constexpr typename alt_bn128_g1_params<254, forms::short_weierstrass>::scalar_field_type::integral_type const
+                        alt_bn128_g1_params<254, forms::short_weierstrass>::glv_lambda;
+                    constexpr std::array<typename alt_bn128_g1_params<254, forms::short_weierstrass>::scalar_field_type::integral_type, 4> const
+                        alt_bn128_g1_params<254, forms::short_weierstrass>::glv_basis;
+                    constexpr std::array<typename alt_bn128_g1_params<254, forms::short_weierstrass>::scalar_field_type::integral_type, 2> const
+                        alt_bn128_g1_params<254, forms::short_weierstrass>::glv_round;
+                    constexpr bool const alt_bn128_g1_params<254, forms::short_weierstrass>::cofactor_is_one;
+
                     constexpr std::array<
                         typename alt_bn128_g2_params<254, forms::short_weierstrass>::field_type::value_type,
                         2> const alt_bn128_g2_params<254, forms::short_weierstrass>::zero_fill;
@@ -122,6 +160,15 @@ namespace nil {
                         typename alt_bn128_g2_params<254, forms::short_weierstrass>::field_type::value_type,
                         2> const alt_bn128_g2_params<254, forms::short_weierstrass>::one_fill;
 
+                    constexpr typename alt_bn128_g2_params<254, forms::short_weierstrass>::field_type::value_type const
+                        alt_bn128_g2_params<254, forms::short_weierstrass>::psi_coeff_x;
+                    constexpr typename alt_bn128_g2_params<254, forms::short_weierstrass>::field_type::value_type const
+                        alt_bn128_g2_params<254, forms::short_weierstrass>::psi_coeff_y;
+                    constexpr typename alt_bn128_g2_params<254, forms::short_weierstrass>::scalar_field_type::integral_type const
+                        alt_bn128_g2_params<254, forms::short_weierstrass>::subgroup_check_scalar;
+                    constexpr bool const alt_bn128_g2_params<254, forms::short_weierstrass>::subgroup_check_scalar_negative;
+                    constexpr std::size_t const alt_bn128_g2_params<254, forms::short_weierstrass>::cofactor_min_prime;
+
                 }    // namespace detail
             }        // namespace curves
         }            // namespace algebra
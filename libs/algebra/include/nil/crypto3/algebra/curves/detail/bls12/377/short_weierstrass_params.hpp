@@ -73,6 +73,15 @@ namespace nil {
                                 0x8848DEFE740A67C8FC6225BF87FF5485951E2CAA9D41BB188282C8BD37CB5CD5481512FFCD394EEAB9B16EB21BE9EF_cppui_modular376),
                             typename field_type::value_type(
                                 0x1914A69C5102EFF1F674F5D30AFEEC4BD7FB348CA3E52D96D182AD44FB82305C2FE3D3634A9591AFD82DE55559C8EA6_cppui_modular377)};
+
+                        /// (x, y) -> (subgroup_check_beta * x, y) acts on the subgroup as multiplication by -z^2, see
+                        /// subgroup_check.hpp
+                        constexpr static const typename field_type::value_type subgroup_check_beta =
+                            typename field_type::value_type(0x1ae3a4617c510eabc8756ba8f8c524eb8882a75cc9bc8e359064ee822fb5bffd1e945779fffffffffffffffffffffff_cppui_modular377);
+                        constexpr static const typename scalar_field_type::integral_type subgroup_check_scalar =
+                            0x452217cc900000010a11800000000001_cppui_modular253;
+                        constexpr static const bool subgroup_check_scalar_negative = true;
+                        constexpr static const std::size_t cofactor_min_prime = 2;    ///< smallest prime factor of the cofactor
                     };
 
                     template<>
@@ -106,6 +115,19 @@ namespace nil {
                             typename field_type::value_type(
                                 0x118DD509B2E9A13744A507D515A595DBB7E3B63DF568866473790184BDF83636C94DF2B7A962CB2AF4337F07CB7E622_cppui_modular377,
                                 0x185067C6CA76D992F064A432BD9F9BE832B0CAC2D824D0518F77D39E76C3E146AFB825F2092218D038867D7F337A010_cppui_modular377)};
+
+                        /// psi(x, y) = (psi_coeff_x * conj(x), psi_coeff_y * conj(y)) acts on the subgroup as
+                        /// multiplication by z, see subgroup_check.hpp
+                        constexpr static const typename field_type::value_type psi_coeff_x = typename field_type::value_type(
+                            0x9b3af05dd14f6ec619aaf7d34594aabc5ed1347970dec00452217cc900000008508c00000000002_cppui_modular377,
+                            0x0_cppui_modular377);
+                        constexpr static const typename field_type::value_type psi_coeff_y = typename field_type::value_type(
+                            0x1680a40796537cac0c534db1a79beb1400398f50ad1dec1bce649cf436b0f6299588459bff27d8e6e76d5ecf1391c63_cppui_modular377,
+                            0x0_cppui_modular377);
+                        constexpr static const typename scalar_field_type::integral_type subgroup_check_scalar =
+                            0x8508c00000000001_cppui_modular253;
+                        constexpr static const bool subgroup_check_scalar_negative = false;
+                        constexpr static const std::size_t cofactor_min_prime = 10000000;    ///< the cofactor has no prime factor below 10^7
                     };
 
                     constexpr
@@ -120,6 +142,13 @@ namespace nil {
                         typename bls12_g1_params<377, forms::short_weierstrass>::field_type::value_type,
                         2> const bls12_g1_params<377, forms::short_weierstrass>::one_fill;
 
+                    constexpr typename bls12_g1_params<377, forms::short_weierstrass>::field_type::value_type const
+                        bls12_g1_params<377, forms::short_weierstrass>::subgroup_check_beta;
+                    constexpr typename bls12_g1_params<377, forms::short_weierstrass>::scalar_field_type::integral_type const
+                        bls12_g1_params<377, forms::short_weierstrass>::subgroup_check_scalar;
+                    constexpr bool const bls12_g1_params<377, forms::short_weierstrass>::subgroup_check_scalar_negative;
+                    constexpr std::size_t const bls12_g1_params<377, forms::short_weierstrass>::cofactor_min_prime;
+
                     constexpr std::array<
                         typename bls12_g2_params<377, forms::short_weierstrass>::field_type::value_type,
                         2> const bls12_g2_params<377, forms::short_weierstrass>::zero_fill;
@@ -127,6 +156,15 @@ namespace nil {
                         typename bls12_g2_params<377, forms::short_weierstrass>::field_type::value_type,
                         2> const bls12_g2_params<377, forms::short_weierstrass>::one_fill;
 
+                    constexpr typename bls12_g2_params<377, forms::short_weierstrass>::field_type::value_type const
+                        bls12_g2_params<377, forms::short_weierstrass>::psi_coeff_x;
+                    constexpr typename bls12_g2_params<377, forms::short_weierstrass>::field_type::value_type const
+                        bls12_g2_params<377, forms::short_weierstrass>::psi_coeff_y;
+                    constexpr typename bls12_g2_params<377, forms::short_weierstrass>::scalar_field_type::integral_type const
+                        bls12_g2_params<377, forms::short_weierstrass>::subgroup_check_scalar;
+                    constexpr bool const bls12_g2_params<377, forms::short_weierstrass>::subgroup_check_scalar_negative;
+                    constexpr std::size_t const bls12_g2_params<377, forms::short_weierstrass>::cofactor_min_prime;
+
                 }    // namespace detail
             }        // namespace curves
         }            // namespace algebra
@@ -73,6 +73,26 @@ namespace nil {
                                 0x17F1D3A73197D7942695638C4FA9AC0FC3688C4F9774B905A14E3A3F171BAC586C55E83FF97A1AEFFB3AF00ADB22C6BB_cppui_modular381),
                             typename field_type::value_type(
                                 0x8B3F481E3AAA0F1A09E30ED741D8AE4FCF5E095D5D00AF600DB18CB2C04B3EDD03CC744A2888AE40CAA232946C5E7E1_cppui_modular380)};
+
+                        /// (x, y) -> (glv_beta * x, y) acts on the subgroup as multiplication by glv_lambda, see glv.hpp
+                        constexpr static const typename field_type::value_type glv_beta =
+                            typename field_type::value_type(0x1a0111ea397fe699ec02408663d4de85aa0d857d89759ad4897d29650fb85f9b409427eb4f49fffd8bfd00000000aaac_cppui_modular381);
+                        constexpr static const typename scalar_field_type::integral_type glv_lambda =
+                            0xac45a4010001a40200000000ffffffff_cppui_modular255;
+                        constexpr static const std::array<typename scalar_field_type::integral_type, 4> glv_basis = {
+                            0xac45a4010001a40200000000ffffffff_cppui_modular255, 0x1_cppui_modular255,
+                            0x1_cppui_modular255, 0xac45a4010001a4020000000100000000_cppui_modular255};
+                        constexpr static const std::array<typename scalar_field_type::integral_type, 2> glv_round = {
+                            0xbe35f678f00fd56eb1fb72917b67f718_cppui_modular255, 0x1_cppui_modular255};
+
+                        /// (x, y) -> (subgroup_check_beta * x, y) acts on the subgroup as multiplication by -z^2, see
+                        /// subgroup_check.hpp
+                        constexpr static const typename field_type::value_type subgroup_check_beta =
+                            typename field_type::value_type(0x5f19672fdf76ce51ba69c6076a0f77eaddb3a93be6f89688de17d813620a00022e01fffffffefffe_cppui_modular381);
+                        constexpr static const typename scalar_field_type::integral_type subgroup_check_scalar =
+                            0xac45a4010001a4020000000100000000_cppui_modular255;
+                        constexpr static const bool subgroup_check_scalar_negative = true;
+                        constexpr static const std::size_t cofactor_min_prime = 3;    ///< smallest prime factor of the cofactor
                     };
 
                     template<>
@@ -106,6 +126,32 @@ namespace nil {
                             typename field_type::value_type(
                                 0xCE5D527727D6E118CC9CDC6DA2E351AADFD9BAA8CBDD3A76D429A695160D12C923AC9CC3BACA289E193548608B82801_cppui_modular380,
                                 0x606C4A02EA734CC32ACD2B02BC28B99CB3E287E85A763AF267492AB572E99AB3F370D275CEC1DA1AAA9075FF05F79BE_cppui_modular379)};
+
+                        /// (x, y) -> (glv_beta * x, y) acts on the subgroup as multiplication by glv_lambda, see glv.hpp
+                        constexpr static const typename field_type::value_type glv_beta = typename field_type::value_type(
+                            typename field_type::value_type::underlying_type(
+                                0x1a0111ea397fe699ec02408663d4de85aa0d857d89759ad4897d29650fb85f9b409427eb4f49fffd8bfd00000000aaac_cppui_modular381),
+                            field_type::value_type::underlying_type::zero());
+                        constexpr static const typename scalar_field_type::integral_type glv_lambda =
+                            0x73eda753299d7d483339d80809a1d804a7780001fffcb7fcfffffffe00000001_cppui_modular255;
+                        constexpr static const std::array<typename scalar_field_type::integral_type, 4> glv_basis = {
+                            0x1_cppui_modular255, 0xac45a4010001a40200000000ffffffff_cppui_modular255,
+                            0xac45a4010001a4020000000100000000_cppui_modular255, 0x1_cppui_modular255};
+                        constexpr static const std::array<typename scalar_field_type::integral_type, 2> glv_round = {
+                            0x1_cppui_modular255, 0xbe35f678f00fd56eb1fb72917b67f717_cppui_modular255};
+
+                        /// psi(x, y) = (psi_coeff_x * conj(x), psi_coeff_y * conj(y)) acts on the subgroup as
+                        /// multiplication by z, see subgroup_check.hpp
+                        constexpr static const typename field_type::value_type psi_coeff_x = typename field_type::value_type(
+                            0x0_cppui_modular381,
+                            0x1a0111ea397fe699ec02408663d4de85aa0d857d89759ad4897d29650fb85f9b409427eb4f49fffd8bfd00000000aaad_cppui_modular381);
+                        constexpr static const typename field_type::value_type psi_coeff_y = typename field_type::value_type(
+                            0x135203e60180a68ee2e9c448d77a2cd91c3dedd930b1cf60ef396489f61eb45e304466cf3e67fa0af1ee7b04121bdea2_cppui_modular381,
+                            0x6af0e0437ff400b6831e36d6bd17ffe48395dabc2d3435e77f76e17009241c5ee67992f72ec05f4c81084fbede3cc09_cppui_modular381);
+                        constexpr static const typename scalar_field_type::integral_type subgroup_check_scalar =
+                            0xd201000000010000_cppui_modular255;
+                        constexpr static const bool subgroup_check_scalar_negative = true;
+                        constexpr static const std::size_t cofactor_min_prime = 13;    ///< smallest prime factor of the cofactor
                     };
 
                     constexpr
@@ -123,6 +169,22 @@ namespace nil {
                         typename bls12_g1_params<381, forms::short_weierstrass>::field_type::value_type,
                         2> const bls12_g1_params<381, forms::short_weierstrass>::one_fill;
 
+                    constexpr typename bls12_g1_params<381, forms::short_weierstrass>::field_type::value_type const
+                        bls12_g1_params<381, forms::short_weierstrass>::glv_beta;
+                    constexpr typename bls12_g1_params<381, forms::short_weierstrass>::scalar_field_type::integral_type const
+                        bls12_g1_params<381, forms::short_weierstrass>::glv_lambda;
+                    constexpr std::array<typename bls12_g1_params<381, forms::short_weierstrass>::scalar_field_type::integral_type, 4> const
+                        bls12_g1_params<381, forms::short_weierstrass>::glv_basis;
+                    constexpr std::array<typename bls12_g1_params<381, forms::short_weierstrass>::scalar_field_type::integral_type, 2> const
+                        bls12_g1_params<381, forms::short_weierstrass>::glv_round;
+
+                    constexpr typename bls12_g1_params<381, forms::short_weierstrass>::field_type::value_type const
+                        bls12_g1_params<381, forms::short_weierstrass>::subgroup_check_beta;
+                    constexpr typename bls12_g1_params<381, forms::short_weierstrass>::scalar_field_type::integral_type const
+                        bls12_g1_params<381, forms::short_weierstrass>::subgroup_check_scalar;
+                    constexpr bool const bls12_g1_params<381, forms::short_weierstrass>::subgroup_check_scalar_negative;
+                    constexpr std::size_t const bls12_g1_params<381, forms::short_weierstrass>::cofactor_min_prime;
+
                     constexpr std::array<
                         typename bls12_g2_params<381, forms::short_weierstrass>::field_type::value_type,
                         2> const bls12_g2_params<381, forms::short_weierstrass>::zero_fill;
@@ -130,6 +192,24 @@ namespace nil {
                         typename bls12_g2_params<381, forms::short_weierstrass>::field_type::value_type,
                         2> const bls12_g2_params<381, forms::short_weierstrass>::one_fill;
 
+                    constexpr typename bls12_g2_params<381, forms::short_weierstrass>::field_type::value_type const
+                        bls12_g2_params<381, forms::short_weierstrass>::glv_beta;
+                    constexpr typename bls12_g2_params<381, forms::short_weierstrass>::scalar_field_type::integral_type const
+                        bls12_g2_params<381, forms::short_weierstrass>::glv_lambda;
+                    constexpr std::array<typename bls12_g2_params<381, forms::short_weierstrass>::scalar_field_type::integral_type, 4> const
+                        bls12_g2_params<381, forms::short_weierstrass>::glv_basis;
+                    constexpr std::array<typename bls12_g2_params<381, forms::short_weierstrass>::scalar_field_type::integral_type, 2> const
+                        bls12_g2_params<381, forms::short_weierstrass>::glv_round;
+
+                    constexpr typename bls12_g2_params<381, forms::short_weierstrass>::field_type::value_type const
+                        bls12_g2_params<381, forms::short_weierstrass>::psi_coeff_x;
+                    constexpr typename bls12_g2_params<381, forms::short_weierstrass>::field_type::value_type const
+                        bls12_g2_params<381, forms::short_weierstrass>::psi_coeff_y;
+                    constexpr typename bls12_g2_params<381, forms::short_weierstrass>::scalar_field_type::integral_type const
+                        bls12_g2_params<381, forms::short_weierstrass>::subgroup_check_scalar;
+                    constexpr bool const bls12_g2_params<381, forms::short_weierstrass>::subgroup_check_scalar_negative;
+                    constexpr std::size_t const bls12_g2_params<381, forms::short_weierstrass>::cofactor_min_prime;
+
                 }    // namespace detail
             }        // namespace curves
         }            // namespace algebra
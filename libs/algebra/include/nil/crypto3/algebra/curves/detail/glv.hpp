@@ -0,0 +1,242 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_GLV_HPP
+#define CRYPTO3_ALGEBRA_CURVES_GLV_HPP
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <boost/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /**
+                     * GLV scalar multiplication, see Gallant, Lambert, Vanstone, "Faster Point Multiplication on
+                     * Elliptic Curves with Efficient Endomorphisms", CRYPTO 2001.
+                     *
+                     * The supported curves are y^2 = x^3 + b with a cube root of unity beta in the field of
+                     * definition, so phi(x, y) = (beta * x, y) acts on the subgroup of prime order q as
+                     * multiplication by a cube root of unity lambda modulo q. Group parameters of such a curve
+                     * provide
+                     *  - glv_beta and glv_lambda,
+                     *  - glv_basis = {a1, b1, a2, b2}, where (a1, -b1), (a2, b2) is a reduced basis of the lattice
+                     *    {(k1, k2) : k1 + k2 * lambda = 0 mod q} with a1 * b2 + a2 * b1 = q,
+                     *  - glv_round = {round(2^m * b2 / q), round(2^m * b1 / q)}, m being the bit length of q.
+                     * A scalar k is split into k1 + k2 * lambda with |k1| and |k2| about sqrt(q), so that
+                     * [k]P = [k1]P + [k2]phi(P) takes half of the doublings.
+                     *
+                     * On BLS12 G2 phi equals -psi^2, psi being the untwist-Frobenius-twist endomorphism, so there
+                     * this is the two-dimensional GLS decomposition.
+                     *
+                     * phi acts as lambda on the subgroup of order q only. Hence the decomposition is used by
+                     * glv_mul and the Pippenger multi-exponentiation, whose points are required to be in that
+                     * subgroup, while operator* keeps the generic path valid for any point of the curve.
+                     */
+                    template<typename GroupValueType, typename = void>
+                    struct has_glv_endomorphism : std::false_type { };
+
+                    template<typename GroupValueType>
+                    struct has_glv_endomorphism<GroupValueType,
+                                                std::void_t<decltype(GroupValueType::params_type::glv_beta)>>
+                        : std::true_type { };
+
+                    /**
+                     * @brief k = k1 + k2 * lambda mod q with the signs of k1, k2 kept apart from their magnitudes.
+                     */
+                    template<typename CurveParams>
+                    struct glv_decomposition {
+                        typedef CurveParams params_type;
+                        typedef typename params_type::scalar_field_type scalar_field_type;
+                        typedef typename scalar_field_type::integral_type integral_type;
+
+                        constexpr static const std::size_t modulus_bits = scalar_field_type::modulus_bits;
+
+                        typedef boost::multiprecision::number<
+                            boost::multiprecision::backends::cpp_int_modular_backend<2 * modulus_bits>>
+                            wide_integral_type;
+
+                        integral_type k1;
+                        integral_type k2;
+                        bool k1_negative;
+                        bool k2_negative;
+
+                        /**
+                         * @param k scalar reduced modulo q
+                         */
+                        explicit glv_decomposition(const integral_type &k) {
+                            const wide_integral_type a1 = widen(params_type::glv_basis[0]);
+                            const wide_integral_type b1 = widen(params_type::glv_basis[1]);
+                            const wide_integral_type a2 = widen(params_type::glv_basis[2]);
+                            const wide_integral_type b2 = widen(params_type::glv_basis[3]);
+                            const wide_integral_type wide_k = widen(k);
+
+                            // c1 = round(k * b2 / q), c2 = round(k * b1 / q)
+                            const wide_integral_type half = wide_integral_type(1u) << (modulus_bits - 1);
+                            const wide_integral_type c1 =
+                                (wide_k * widen(params_type::glv_round[0]) + half) >> modulus_bits;
+                            const wide_integral_type c2 =
+                                (wide_k * widen(params_type::glv_round[1]) + half) >> modulus_bits;
+
+                            // (k1, k2) = (k, 0) - c1 * (a1, -b1) - c2 * (a2, b2)
+                            k1_negative = subtract(wide_k, c1 * a1 + c2 * a2, k1);
+                            k2_negative = subtract(c1 * b1, c2 * b2, k2);
+                        }
+
+                    private:
+                        static wide_integral_type widen(const integral_type &value) {
+                            wide_integral_type result;
+                            result.backend() = value.backend();
+                            return result;
+                        }
+
+                        // result = |a - b|, returns a < b
+                        static bool subtract(const wide_integral_type &a, const wide_integral_type &b,
+                                             integral_type &result) {
+                            const bool negative = a < b;
+                            const wide_integral_type difference = negative ? wide_integral_type(b - a) :
+                                                                             wide_integral_type(a - b);
+                            result.backend() = difference.backend();
+                            return negative;
+                        }
+                    };
+
+                    /**
+                     * @brief Joint sparse form of a pair of non-negative integers, see Solinas, "Low-Weight Binary
+                     * Representations for Pairs of Integers", 2001. At most half of the digit pairs are non-zero on
+                     * average, against three quarters for the plain binary expansions.
+                     *
+                     * Digits are in {-1, 0, 1} and stored least significant first.
+                     */
+                    template<typename IntegralType>
+                    void joint_sparse_form(IntegralType k0, IntegralType k1, std::vector<std::int8_t> &u0,
+                                           std::vector<std::int8_t> &u1) {
+                        u0.clear();
+                        u1.clear();
+
+                        unsigned d0 = 0, d1 = 0;
+                        while (!k0.is_zero() || !k1.is_zero() || d0 != 0 || d1 != 0) {
+                            unsigned low0 = 0, low1 = 0;
+                            for (unsigned i = 0; i < 3; ++i) {
+                                low0 |= unsigned(boost::multiprecision::bit_test(k0, i)) << i;
+                                low1 |= unsigned(boost::multiprecision::bit_test(k1, i)) << i;
+                            }
+                            const unsigned l0 = (low0 + d0) & 7u, l1 = (low1 + d1) & 7u;
+
+                            int digit0 = 0, digit1 = 0;
+                            if (l0 & 1u) {
+                                digit0 = 2 - int(l0 & 3u);
+                                if ((l0 == 3 || l0 == 5) && (l1 & 3u) == 2) {
+                                    digit0 = -digit0;
+                                }
+                            }
+                            if (l1 & 1u) {
+                                digit1 = 2 - int(l1 & 3u);
+                                if ((l1 == 3 || l1 == 5) && (l0 & 3u) == 2) {
+                                    digit1 = -digit1;
+                                }
+                            }
+                            u0.push_back(static_cast<std::int8_t>(digit0));
+                            u1.push_back(static_cast<std::int8_t>(digit1));
+
+                            if (2 * int(d0) == 1 + digit0) {
+                                d0 = 1 - d0;
+                            }
+                            if (2 * int(d1) == 1 + digit1) {
+                                d1 = 1 - d1;
+                            }
+                            k0 >>= 1;
+                            k1 >>= 1;
+                        }
+                    }
+
+                    /**
+                     * @brief phi(x, y) = (beta * x, y), the same map in every coordinate system of the short
+                     * Weierstrass form, since they all keep x as X over a power of Z.
+                     */
+                    template<typename GroupValueType>
+                    GroupValueType glv_endomorphism(const GroupValueType &point) {
+                        GroupValueType result = point;
+                        result.X = result.X * GroupValueType::params_type::glv_beta;
+                        return result;
+                    }
+
+                    /**
+                     * @brief [k]P as [k1]P + [k2]phi(P) with an interleaved ladder over the joint sparse form of
+                     * (|k1|, |k2|).
+                     *
+                     * @param scalar k reduced modulo the order of the group
+                     */
+                    template<typename GroupValueType>
+                    GroupValueType glv_scalar_mul(
+                        const GroupValueType &point,
+                        const typename GroupValueType::params_type::scalar_field_type::integral_type &scalar) {
+                        if (scalar.is_zero() || point.is_zero()) {
+                            return GroupValueType::zero();
+                        }
+
+                        const glv_decomposition<typename GroupValueType::params_type> decomposition(scalar);
+
+                        const GroupValueType p1 = decomposition.k1_negative ? -point : point;
+                        const GroupValueType phi = glv_endomorphism(point);
+                        const GroupValueType p2 = decomposition.k2_negative ? -phi : phi;
+                        // [p1 + p2, p1 - p2]
+                        const GroupValueType sum = p1 + p2;
+                        const GroupValueType difference = p1 - p2;
+
+                        std::vector<std::int8_t> u1, u2;
+                        joint_sparse_form(decomposition.k1, decomposition.k2, u1, u2);
+
+                        GroupValueType result = GroupValueType::zero();
+                        for (std::size_t i = u1.size(); i-- > 0;) {
+                            result.double_inplace();
+
+                            const std::int8_t d1 = u1[i], d2 = u2[i];
+                            if (d1 == 0 && d2 == 0) {
+                                continue;
+                            }
+                            if (d2 == 0) {
+                                result += d1 > 0 ? p1 : -p1;
+                            } else if (d1 == 0) {
+                                result += d2 > 0 ? p2 : -p2;
+                            } else if (d1 == d2) {
+                                result += d1 > 0 ? sum : -sum;
+                            } else {
+                                result += d1 > 0 ? difference : -difference;
+                            }
+                        }
+                        return result;
+                    }
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_GLV_HPP
@@ -86,6 +86,17 @@ namespace nil {
                                 //0x7706c37b5a84128a3884a5d71811f1b55da3230ffb17a8ab0b32e48d31a6685c_cppui_modular255),
                             typename field_type::value_type(2u)};
                                 //0x0f60480c7a5c0e1140340adc79d6a2bf0cb57ad049d025dc38d80c77985f0329_cppui_modular255)};
+
+                        /// (x, y) -> (glv_beta * x, y) acts on the subgroup as multiplication by glv_lambda, see glv.hpp
+                        constexpr static typename field_type::value_type glv_beta =
+                            typename field_type::value_type(0x12ccca834acdba712caad5dc57aab1b01d1f8bd237ad31491dad5ebdfdfe4ab9_cppui_modular255);
+                        constexpr static typename scalar_field_type::integral_type glv_lambda =
+                            0x6819a58283e528e511db4d81cf70f5a0fed467d47c033af2aa9d2e050aa0e4f_cppui_modular255;
+                        constexpr static std::array<typename scalar_field_type::integral_type, 4> glv_basis = {
+                            0x49e69d1640f049157fcae1c700000001_cppui_modular255, 0x49e69d1640a899538cb1279300000000_cppui_modular255,
+                            0x49e69d1640a899538cb1279300000000_cppui_modular255, 0x93cd3a2c8198e2690c7c095a00000001_cppui_modular255};
+                        constexpr static std::array<typename scalar_field_type::integral_type, 2> glv_round = {
+                            0x1279a74590331c4d218f812b400000001_cppui_modular255, 0x93cd3a2c815132a719624f2600000000_cppui_modular255};
 #endif
                     };
 
@@ -98,6 +109,15 @@ namespace nil {
                         pallas_g1_params<forms::short_weierstrass>::zero_fill;
                     constexpr std::array<typename pallas_g1_params<forms::short_weierstrass>::field_type::value_type, 2>
                         pallas_g1_params<forms::short_weierstrass>::one_fill;
+
+                    constexpr typename pallas_g1_params<forms::short_weierstrass>::field_type::value_type
+                        pallas_g1_params<forms::short_weierstrass>::glv_beta;
+                    constexpr typename pallas_g1_params<forms::short_weierstrass>::scalar_field_type::integral_type
+                        pallas_g1_params<forms::short_weierstrass>::glv_lambda;
+                    constexpr std::array<typename pallas_g1_params<forms::short_weierstrass>::scalar_field_type::integral_type, 4>
+                        pallas_g1_params<forms::short_weierstrass>::glv_basis;
+                    constexpr std::array<typename pallas_g1_params<forms::short_weierstrass>::scalar_field_type::integral_type, 2>
+                        pallas_g1_params<forms::short_weierstrass>::glv_round;
 #endif
 
                 }    // namespace detail
@@ -36,6 +36,7 @@
 #include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
 
 #include <nil/crypto3/algebra/wnaf.hpp>
+#include <nil/crypto3/algebra/curves/detail/glv.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -202,6 +203,24 @@ namespace nil {
 
                         return right * left;
                     }
+
+                    /**
+                     * @brief [k]P for a point P of the prime order subgroup, e.g. one which passed subgroup_check.
+                     * Uses the GLV decomposition on the curves providing it, see glv.hpp, so the result is wrong
+                     * for the other points of the curve, which operator* handles exactly.
+                     */
+                    template<typename GroupValueType>
+                    GroupValueType glv_mul(
+                        const GroupValueType &point,
+                        const typename GroupValueType::params_type::scalar_field_type::value_type &scalar) {
+                        typedef typename GroupValueType::params_type::scalar_field_type::integral_type integral_type;
+
+                        if constexpr (has_glv_endomorphism<GroupValueType>::value) {
+                            return glv_scalar_mul(point, static_cast<integral_type>(scalar.data));
+                        } else {
+                            return point * static_cast<integral_type>(scalar.data);
+                        }
+                    }
                 }    // namespace detail
             }        // namespace curves
         }            // namespace algebra
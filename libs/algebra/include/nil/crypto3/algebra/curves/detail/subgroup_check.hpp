@@ -26,20 +26,230 @@
 #ifndef CRYPTO3_ALGEBRA_CURVES_SUBGROUP_CHECK_HPP
 #define CRYPTO3_ALGEBRA_CURVES_SUBGROUP_CHECK_HPP
 
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include <boost/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
+
 #include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace algebra {
             namespace curves {
                 namespace detail {
+                    /**
+                     * Membership tests for the subgroup of prime order r of the curve group, see Scott, "A note on
+                     * group membership tests for G1, G2 and GT on BLS pairing-friendly curves",
+                     * https://eprint.iacr.org/2021/1130.
+                     *
+                     * An endomorphism acting on the subgroup as multiplication by a short scalar s gives the test
+                     * endo(P) == [s]P, which is known to hold for the points of the subgroup only:
+                     *  - BLS12 G1: endo(x, y) = (beta * x, y), s = -z^2,
+                     *  - BLS12 G2: endo = psi, the untwist-Frobenius-twist map, s = z,
+                     *  - BN G2: endo = psi, s = 6z^2,
+                     * z being the curve parameter. Group parameters provide subgroup_check_beta or
+                     * psi_coeff_x, psi_coeff_y, with subgroup_check_scalar = |s| and subgroup_check_scalar_negative.
+                     * Groups with cofactor one set cofactor_is_one. Other groups multiply by r.
+                     */
+                    template<typename GroupValueType, typename = void>
+                    struct has_beta_subgroup_check : std::false_type { };
+
+                    template<typename GroupValueType>
+                    struct has_beta_subgroup_check<
+                        GroupValueType, std::void_t<decltype(GroupValueType::params_type::subgroup_check_beta)>>
+                        : std::true_type { };
+
+                    template<typename GroupValueType, typename = void>
+                    struct has_psi_subgroup_check : std::false_type { };
+
+                    template<typename GroupValueType>
+                    struct has_psi_subgroup_check<GroupValueType,
+                                                  std::void_t<decltype(GroupValueType::params_type::psi_coeff_x)>>
+                        : std::true_type { };
+
+                    template<typename GroupValueType, typename = void>
+                    struct has_cofactor_min_prime : std::false_type { };
+
+                    template<typename GroupValueType>
+                    struct has_cofactor_min_prime<
+                        GroupValueType, std::void_t<decltype(GroupValueType::params_type::cofactor_min_prime)>>
+                        : std::true_type { };
+
+                    template<typename GroupValueType, typename = void>
+                    struct has_prime_order : std::false_type { };
+
+                    template<typename GroupValueType>
+                    struct has_prime_order<GroupValueType,
+                                           std::void_t<decltype(GroupValueType::params_type::cofactor_is_one)>>
+                        : std::integral_constant<bool, GroupValueType::params_type::cofactor_is_one> { };
+
+                    /**
+                     * @brief The endomorphism used by the membership test.
+                     */
+                    template<typename GroupValueType>
+                    GroupValueType subgroup_check_endomorphism(const GroupValueType &point) {
+                        typedef typename GroupValueType::params_type params_type;
+
+                        GroupValueType result = point;
+                        if constexpr (has_beta_subgroup_check<GroupValueType>::value) {
+                            result.X = point.X * params_type::subgroup_check_beta;
+                        } else {
+                            if (point.is_zero()) {
+                                return result;
+                            }
+                            // conjugation is the Frobenius map of F_p^2, any representation x = X / Z^k commutes
+                            // with it
+                            result.X = point.X.Frobenius_map(1) * params_type::psi_coeff_x;
+                            result.Y = point.Y.Frobenius_map(1) * params_type::psi_coeff_y;
+                            if constexpr (!std::is_same<typename GroupValueType::coordinates,
+                                                        coordinates::affine>::value) {
+                                result.Z = point.Z.Frobenius_map(1);
+                            }
+                        }
+                        return result;
+                    }
+
                     // TODO: temporary implementation due to absence of GroupValueType type_trait
                     //  Should be implemented as class method
+                    /**
+                     * @brief Checks that a point of the curve lies in the subgroup of prime order.
+                     */
                     template<typename GroupValueType, typename = typename std::enable_if<
                                                           is_curve_group<typename GroupValueType::group_type>::value &&
                                                           !is_field<typename GroupValueType::group_type>::value>::type>
                     bool subgroup_check(const GroupValueType &p) {
-                        return (p * GroupValueType::group_type::curve_type::q).is_zero();
+                        typedef typename GroupValueType::params_type params_type;
+
+                        if constexpr (has_prime_order<GroupValueType>::value) {
+                            return true;
+                        } else if constexpr (has_beta_subgroup_check<GroupValueType>::value ||
+                                             has_psi_subgroup_check<GroupValueType>::value) {
+                            const GroupValueType sp = p * params_type::subgroup_check_scalar;
+                            return subgroup_check_endomorphism(p) ==
+                                   (params_type::subgroup_check_scalar_negative ? -sp : sp);
+                        } else {
+                            return (p * GroupValueType::group_type::curve_type::scalar_field_type::modulus).is_zero();
+                        }
+                    }
+
+                    /**
+                     * @brief Estimated number of group operations of subgroup_check: the doublings and the wNAF
+                     * additions of the scalar multiplication.
+                     */
+                    template<typename GroupValueType>
+                    std::size_t subgroup_check_cost() {
+                        typedef typename GroupValueType::params_type params_type;
+
+                        std::size_t bits;
+                        if constexpr (has_beta_subgroup_check<GroupValueType>::value ||
+                                      has_psi_subgroup_check<GroupValueType>::value) {
+                            bits = boost::multiprecision::msb(params_type::subgroup_check_scalar) + 1;
+                        } else {
+                            bits = GroupValueType::group_type::curve_type::scalar_field_type::modulus_bits;
+                        }
+                        return bits + bits / 5;
+                    }
+
+                    /**
+                     * @brief Checks that all the points of [first, last) lie on the curve and in the subgroup of
+                     * prime order, with a failure probability below 2^-security_bits.
+                     *
+                     * A round checks sum_i r_i * P_i with random 16-bit r_i, computed with one
+                     * multi-exponentiation. If P_j is outside the subgroup, its component of
+                     * order m > 1 in the cofactor part vanishes from the sum for at most one residue of r_j modulo
+                     * m, so a round passes with probability at most 1 / l + 2^-16, l being the smallest prime
+                     * factor of the cofactor, params_type::cofactor_min_prime. Rounds are repeated until this is
+                     * below 2^-security_bits. Wider coefficients would not help, a component of order 2 or 3
+                     * vanishes for half or a third of any r_j.
+                     *
+                     * With a small l the rounds may cost more than checking every point: 64 bits of security
+                     * take 64 rounds for l = 2 and 41 for l = 3, each about (16 / c + 1) * (n + 2^c) additions
+                     * with the Pippenger window c. The points are then checked one by one with
+                     * subgroup_check, as they are for the groups without cofactor_min_prime.
+                     *
+                     * The points are fixed before the generator is seeded, so a statistically good generator
+                     * seeded from std::random_device is enough.
+                     */
+                    template<typename InputIterator>
+                    bool batch_subgroup_check(InputIterator first, InputIterator last,
+                                              const std::size_t security_bits = 64) {
+                        typedef typename std::iterator_traits<InputIterator>::value_type group_value_type;
+                        typedef typename group_value_type::params_type params_type;
+
+                        constexpr std::size_t scalar_bits = 16;
+                        typedef boost::multiprecision::number<
+                            boost::multiprecision::backends::cpp_int_modular_backend<scalar_bits>>
+                            scalar_type;
+
+                        const std::size_t length = std::distance(first, last);
+
+                        bool well_formed = true;
+#ifdef MULTICORE
+#pragma omp parallel for reduction(&& : well_formed)
+#endif
+                        for (std::size_t i = 0; i < length; i++) {
+                            well_formed = well_formed && first[i].is_well_formed();
+                        }
+                        if (!well_formed) {
+                            return false;
+                        }
+
+                        const auto check_each = [first, length]() {
+                            bool in_subgroup = true;
+#ifdef MULTICORE
+#pragma omp parallel for reduction(&& : in_subgroup)
+#endif
+                            for (std::size_t i = 0; i < length; i++) {
+                                in_subgroup = in_subgroup && subgroup_check(first[i]);
+                            }
+                            return in_subgroup;
+                        };
+
+                        if constexpr (has_prime_order<group_value_type>::value) {
+                            return true;
+                        } else if constexpr (!has_cofactor_min_prime<group_value_type>::value) {
+                            return check_each();
+                        } else {
+                            const double round_bits =
+                                -std::log2(1.0 / double(params_type::cofactor_min_prime) +
+                                           std::ldexp(1.0, -int(scalar_bits)));
+                            const std::size_t rounds = std::size_t(std::ceil(double(security_bits) / round_bits));
+
+                            const std::size_t c = policies::multiexp_method_pippenger::window_size(length);
+                            const std::size_t round_cost = (scalar_bits / c + 1) * (length + (std::size_t(1) << c)) +
+                                                           scalar_bits + subgroup_check_cost<group_value_type>();
+                            if (rounds * round_cost >= length * subgroup_check_cost<group_value_type>()) {
+                                return check_each();
+                            }
+
+                            std::random_device device;
+                            std::seed_seq seed {device(), device(), device(), device()};
+                            std::mt19937_64 rng(seed);
+
+                            std::vector<scalar_type> scalars(length);
+                            for (std::size_t round = 0; round < rounds; round++) {
+                                for (std::size_t i = 0; i < length; i++) {
+                                    scalars[i] = scalar_type(
+                                        rng() & ((std::uint64_t(1) << scalar_bits) - 1));
+                                }
+                                const group_value_type sum =
+                                    policies::multiexp_method_pippenger::bucket_sum<group_value_type>(
+                                        first, length, scalar_bits,
+                                        [&scalars](std::size_t i) -> const scalar_type & { return scalars[i]; });
+                                if (!subgroup_check(sum)) {
+                                    return false;
+                                }
+                            }
+                            return true;
+                        }
                     }
                 }    // namespace detail
             }        // namespace curves
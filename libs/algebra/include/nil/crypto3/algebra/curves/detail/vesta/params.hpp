@@ -87,6 +87,17 @@ namespace nil {
                                 //0x7706c37b5a84128a3884a5d71811f1b55da3230ffb17a8ab0b32e48d31a6685c_cppui_modular255),
                             typename field_type::value_type(2u)};
                                 //0x0f60480c7a5c0e1140340adc79d6a2bf0cb57ad049d025dc38d80c77985f0329_cppui_modular255)};
+
+                        /// (x, y) -> (glv_beta * x, y) acts on the subgroup as multiplication by glv_lambda, see glv.hpp
+                        constexpr static typename field_type::value_type glv_beta =
+                            typename field_type::value_type(0x397e65a7d7c1ad71aee24b27e308f0a61259527ec1d4752e619d1840af55f1b1_cppui_modular255);
+                        constexpr static typename scalar_field_type::integral_type glv_lambda =
+                            0x2d33357cb532458ed3552a23a8554e5005270d29d19fc7d27b7fd22f0201b547_cppui_modular255;
+                        constexpr static std::array<typename scalar_field_type::integral_type, 4> glv_basis = {
+                            0x49e69d1640a899538cb1279300000001_cppui_modular255, 0x49e69d1640f049157fcae1c700000000_cppui_modular255,
+                            0x93cd3a2c8198e2690c7c095a00000001_cppui_modular255, 0x49e69d1640a899538cb1279300000001_cppui_modular255};
+                        constexpr static std::array<typename scalar_field_type::integral_type, 2> glv_round = {
+                            0x93cd3a2c815132a719624f2600000002_cppui_modular255, 0x93cd3a2c81e0922aff95c38e00000000_cppui_modular255};
 #endif
                     };
 
@@ -99,6 +110,15 @@ namespace nil {
                         vesta_g1_params<forms::short_weierstrass>::zero_fill;
                     constexpr std::array<typename vesta_g1_params<forms::short_weierstrass>::field_type::value_type, 2>
                         vesta_g1_params<forms::short_weierstrass>::one_fill;
+
+                    constexpr typename vesta_g1_params<forms::short_weierstrass>::field_type::value_type
+                        vesta_g1_params<forms::short_weierstrass>::glv_beta;
+                    constexpr typename vesta_g1_params<forms::short_weierstrass>::scalar_field_type::integral_type
+                        vesta_g1_params<forms::short_weierstrass>::glv_lambda;
+                    constexpr std::array<typename vesta_g1_params<forms::short_weierstrass>::scalar_field_type::integral_type, 4>
+                        vesta_g1_params<forms::short_weierstrass>::glv_basis;
+                    constexpr std::array<typename vesta_g1_params<forms::short_weierstrass>::scalar_field_type::integral_type, 2>
+                        vesta_g1_params<forms::short_weierstrass>::glv_round;
 #endif
 
                 }    // namespace detail
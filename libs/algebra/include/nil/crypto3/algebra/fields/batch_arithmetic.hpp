@@ -0,0 +1,235 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Element-wise arithmetic over contiguous arrays of field elements.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_BATCH_ARITHMETIC_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_BATCH_ARITHMETIC_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <nil/crypto3/algebra/fields/detail/element/fp.hpp>
+
+#ifndef __ZKLLVM__
+#include <nil/crypto3/algebra/fields/detail/element/fp_ifma_arithmetic.hpp>
+#include <nil/crypto3/algebra/fields/goldilocks64/vector_arithmetic.hpp>
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+
+                namespace detail {
+                    // The element operators in a loop, works for any ValueType.
+                    template<typename ValueType>
+                    struct scalar_batch_arithmetic {
+                        typedef ValueType value_type;
+
+                        static void add(value_type *r, const value_type *a, const value_type *b, std::size_t n) {
+                            for (std::size_t i = 0; i < n; ++i) {
+                                r[i] = a[i] + b[i];
+                            }
+                        }
+
+                        static void sub(value_type *r, const value_type *a, const value_type *b, std::size_t n) {
+                            for (std::size_t i = 0; i < n; ++i) {
+                                r[i] = a[i] - b[i];
+                            }
+                        }
+
+                        static void mul(value_type *r, const value_type *a, const value_type *b, std::size_t n) {
+                            for (std::size_t i = 0; i < n; ++i) {
+                                r[i] = a[i] * b[i];
+                            }
+                        }
+
+                        static void mul(value_type *r, const value_type *a, const value_type &c, std::size_t n) {
+                            // c may be an element of r.
+                            const value_type constant = c;
+                            for (std::size_t i = 0; i < n; ++i) {
+                                r[i] = a[i] * constant;
+                            }
+                        }
+
+                        static void square(value_type *r, const value_type *a, std::size_t n) {
+                            for (std::size_t i = 0; i < n; ++i) {
+                                r[i] = a[i].squared();
+                            }
+                        }
+
+                        static void butterfly(value_type *x, value_type *y, const value_type *w, std::size_t n) {
+                            for (std::size_t i = 0; i < n; ++i) {
+                                const value_type t = w[i] * y[i];
+                                y[i] = x[i] - t;
+                                x[i] += t;
+                            }
+                        }
+                    };
+                }    // namespace detail
+
+                /**
+                 * Batched arithmetic on arrays of n field elements:
+                 *
+                 *     add, sub, mul:  r[i] = a[i] op b[i]
+                 *     mul:            r[i] = a[i] * c
+                 *     square:         r[i] = a[i]^2
+                 *     butterfly:      t = w[i] * y[i], then y[i] = x[i] - t and x[i] = x[i] + t
+                 *
+                 * The outputs may alias the inputs. Fields with a vectorized implementation are
+                 * specialized below, which kernel runs is decided at runtime from cpuid. The primary
+                 * template falls back to the element operators.
+                 */
+                template<typename ValueType, typename Enable = void>
+                struct batch_arithmetic : public detail::scalar_batch_arithmetic<ValueType> { };
+
+#ifndef __ZKLLVM__
+                template<>
+                struct batch_arithmetic<goldilocks64_base_field::value_type> {
+                    typedef goldilocks64_base_field::value_type value_type;
+
+                    static void add(value_type *r, const value_type *a, const value_type *b, std::size_t n) {
+                        goldilocks64_vector_arithmetic::add(r, a, b, n);
+                    }
+
+                    static void sub(value_type *r, const value_type *a, const value_type *b, std::size_t n) {
+                        goldilocks64_vector_arithmetic::sub(r, a, b, n);
+                    }
+
+                    static void mul(value_type *r, const value_type *a, const value_type *b, std::size_t n) {
+                        goldilocks64_vector_arithmetic::mul(r, a, b, n);
+                    }
+
+                    static void mul(value_type *r, const value_type *a, const value_type &c, std::size_t n) {
+                        goldilocks64_vector_arithmetic::mul(r, a, c, n);
+                    }
+
+                    static void square(value_type *r, const value_type *a, std::size_t n) {
+                        goldilocks64_vector_arithmetic::mul(r, a, a, n);
+                    }
+
+                    static void butterfly(value_type *x, value_type *y, const value_type *w, std::size_t n) {
+                        goldilocks64_vector_arithmetic::butterfly(x, y, w, n);
+                    }
+                };
+
+                namespace detail {
+                    // Prime fields in Montgomery form with four 64-bit limbs and p < 2^255, see
+                    // fp4_ifma_arithmetic.
+                    template<typename FieldParams>
+                    struct is_fp4_ifma_friendly {
+                        typedef typename FieldParams::modular_backend backend_type;
+
+                        constexpr static const bool value = FieldParams::modulus_bits > 192 &&
+                                                            FieldParams::modulus_bits <= 255 &&
+                                                            sizeof(typename backend_type::limb_type) == 8;
+                    };
+                }    // namespace detail
+
+                /**
+                 * Multiplications go through the IFMA kernel when the CPU has it, additions and the
+                 * tails stay on the scalar element operators.
+                 */
+                template<typename FieldParams>
+                struct batch_arithmetic<detail::element_fp<FieldParams>,
+                                        typename std::enable_if<detail::is_fp4_ifma_friendly<FieldParams>::value>::type>
+                    : public detail::scalar_batch_arithmetic<detail::element_fp<FieldParams>> {
+                    typedef detail::element_fp<FieldParams> value_type;
+                    typedef detail::scalar_batch_arithmetic<value_type> scalar_type;
+
+                    using scalar_type::add;
+                    using scalar_type::sub;
+
+                    static void mul(value_type *r, const value_type *a, const value_type *b, std::size_t n) {
+                        std::size_t i = 0;
+                        if (n >= block_size && detail::fp4_ifma_arithmetic::available()) {
+                            i = kernel().mul(limbs(r), limbs(a), limbs(b), sizeof(value_type), n);
+                        }
+                        scalar_type::mul(r + i, a + i, b + i, n - i);
+                    }
+
+                    static void mul(value_type *r, const value_type *a, const value_type &c, std::size_t n) {
+                        const value_type constant = c;
+                        std::size_t i = 0;
+                        if (n >= block_size && detail::fp4_ifma_arithmetic::available()) {
+                            i = kernel().mul_constant(limbs(r), limbs(a), limbs(&constant), sizeof(value_type), n);
+                        }
+                        scalar_type::mul(r + i, a + i, constant, n - i);
+                    }
+
+                    static void square(value_type *r, const value_type *a, std::size_t n) {
+                        mul(r, a, a, n);
+                    }
+
+                    static void butterfly(value_type *x, value_type *y, const value_type *w, std::size_t n) {
+                        if (n < block_size || !detail::fp4_ifma_arithmetic::available()) {
+                            scalar_type::butterfly(x, y, w, n);
+                            return;
+                        }
+                        std::array<value_type, chunk_size> t;
+                        for (std::size_t begin = 0; begin < n; begin += chunk_size) {
+                            const std::size_t length = (std::min)(chunk_size, n - begin);
+                            mul(t.data(), w + begin, y + begin, length);
+                            for (std::size_t i = 0; i < length; ++i) {
+                                y[begin + i] = x[begin + i] - t[i];
+                                x[begin + i] += t[i];
+                            }
+                        }
+                    }
+
+                private:
+                    constexpr static const std::size_t block_size = 8;
+                    constexpr static const std::size_t chunk_size = 64;
+
+                    static const detail::fp4_ifma_arithmetic &kernel() {
+                        static const detail::fp4_ifma_arithmetic instance(
+                            modulus_limbs(value_type::modulus_params.get_mod_obj().get_mod()),
+                            value_type::modulus_params.get_mod_obj().get_p_dash());
+                        return instance;
+                    }
+
+                    template<typename Backend>
+                    static const std::uint64_t *modulus_limbs(const Backend &modulus) {
+                        return reinterpret_cast<const std::uint64_t *>(modulus.limbs());
+                    }
+
+                    static std::uint64_t *limbs(value_type *x) {
+                        return reinterpret_cast<std::uint64_t *>(x->data.backend().base_data().limbs());
+                    }
+
+                    static const std::uint64_t *limbs(const value_type *x) {
+                        return reinterpret_cast<const std::uint64_t *>(x->data.backend().base_data().limbs());
+                    }
+                };
+#endif
+            }    // namespace fields
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_BATCH_ARITHMETIC_HPP
@@ -0,0 +1,77 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Runtime detection of the x86 vector extensions used by the batched field arithmetic.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_DETAIL_CPU_FEATURES_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_DETAIL_CPU_FEATURES_HPP
+
+#include <nil/crypto3/multiprecision/detail/cpu_features.hpp>
+
+#if defined(CRYPTO3_MP_X86_CPU_FEATURES) && defined(__x86_64__)
+// Kernels for the extensions below are compiled with target attributes and picked at runtime.
+#define CRYPTO3_ALGEBRA_FIELDS_X86_DISPATCH
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+
+#ifdef CRYPTO3_ALGEBRA_FIELDS_X86_DISPATCH
+                    // The probe is shared with the Montgomery and SHA-256 kernels.
+                    using cpu_features = boost::multiprecision::backends::cpu_features;
+#endif
+
+                    inline bool has_avx2() {
+#ifdef CRYPTO3_ALGEBRA_FIELDS_X86_DISPATCH
+                        return cpu_features::get().avx2;
+#else
+                        return false;
+#endif
+                    }
+
+                    inline bool has_avx512f() {
+#ifdef CRYPTO3_ALGEBRA_FIELDS_X86_DISPATCH
+                        return cpu_features::get().avx512f;
+#else
+                        return false;
+#endif
+                    }
+
+                    inline bool has_avx512ifma() {
+#ifdef CRYPTO3_ALGEBRA_FIELDS_X86_DISPATCH
+                        return cpu_features::get().avx512ifma;
+#else
+                        return false;
+#endif
+                    }
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_DETAIL_CPU_FEATURES_HPP
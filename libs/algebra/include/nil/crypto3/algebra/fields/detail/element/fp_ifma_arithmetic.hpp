@@ -0,0 +1,273 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Montgomery multiplication of eight 4-limb field elements at once with AVX-512 IFMA.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FP_IFMA_ARITHMETIC_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FP_IFMA_ARITHMETIC_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <nil/crypto3/algebra/fields/detail/cpu_features.hpp>
+
+#ifdef CRYPTO3_ALGEBRA_FIELDS_X86_DISPATCH
+#include <immintrin.h>
+
+#define CRYPTO3_FP_IFMA __attribute__((target("avx512f,avx512ifma")))
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+
+                    /**
+                     * Montgomery multiplication modulo p < 2^255 for elements stored as four 64-bit limbs with
+                     * R = 2^256, eight elements per call.
+                     *
+                     * IFMA multiplies 52-bit limbs, so the elements are split into five of them. Five reduction
+                     * rounds divide by 2^260 rather than 2^256, which is compensated by multiplying the second
+                     * operand by 16 when splitting it: 16 * b still fits into 260 bits while p < 2^255. The
+                     * result before the final subtraction is below a * 16 * b / 2^260 + p < 1.5 * p.
+                     *
+                     * The limbs of consecutive elements lie "stride" bytes apart, they are gathered and
+                     * scattered directly from the element arrays. All the inputs of a block are loaded before
+                     * anything is stored, so the output may alias the inputs.
+                     */
+                    class fp4_ifma_arithmetic {
+                    public:
+                        static bool available() {
+                            return has_avx512ifma();
+                        }
+
+                        fp4_ifma_arithmetic(const std::uint64_t *modulus, std::uint64_t p_dash) {
+                            split(modulus, m_modulus);
+                            m_p_dash = p_dash & mask;
+                        }
+
+                        // r[i] = a[i] * b[i] for the longest prefix of whole blocks, returns its length.
+                        std::size_t mul(std::uint64_t *r, const std::uint64_t *a, const std::uint64_t *b,
+                                        std::size_t stride, std::size_t n) const {
+#ifdef CRYPTO3_ALGEBRA_FIELDS_X86_DISPATCH
+                            return mul_ifma(r, a, b, stride, n);
+#else
+                            return 0;
+#endif
+                        }
+
+                        // r[i] = a[i] * b with b given by its four limbs.
+                        std::size_t mul_constant(std::uint64_t *r, const std::uint64_t *a, const std::uint64_t *b,
+                                                 std::size_t stride, std::size_t n) const {
+#ifdef CRYPTO3_ALGEBRA_FIELDS_X86_DISPATCH
+                            return mul_constant_ifma(r, a, b, stride, n);
+#else
+                            return 0;
+#endif
+                        }
+
+                    private:
+                        constexpr static const std::size_t limbs = 5;
+                        constexpr static const std::uint64_t mask = (std::uint64_t(1) << 52) - 1;
+
+                        static void split(const std::uint64_t *x, std::uint64_t *l) {
+                            l[0] = x[0] & mask;
+                            l[1] = ((x[0] >> 52) | (x[1] << 12)) & mask;
+                            l[2] = ((x[1] >> 40) | (x[2] << 24)) & mask;
+                            l[3] = ((x[2] >> 28) | (x[3] << 36)) & mask;
+                            l[4] = x[3] >> 16;
+                        }
+
+                        // Splits 16 * x.
+                        static void split_shifted(const std::uint64_t *x, std::uint64_t *l) {
+                            l[0] = (x[0] << 4) & mask;
+                            l[1] = ((x[0] >> 48) | (x[1] << 16)) & mask;
+                            l[2] = ((x[1] >> 36) | (x[2] << 28)) & mask;
+                            l[3] = ((x[2] >> 24) | (x[3] << 40)) & mask;
+                            l[4] = x[3] >> 12;
+                        }
+
+#ifdef CRYPTO3_ALGEBRA_FIELDS_X86_DISPATCH
+                        CRYPTO3_FP_IFMA static inline void load(const std::uint64_t *x, __m512i offsets,
+                                                                __m512i *words) {
+                            const char *base = reinterpret_cast<const char *>(x);
+                            for (std::size_t k = 0; k < 4; ++k) {
+                                words[k] = _mm512_i64gather_epi64(offsets, base + 8 * k, 1);
+                            }
+                        }
+
+                        CRYPTO3_FP_IFMA static inline void store(std::uint64_t *x, __m512i offsets,
+                                                                 const __m512i *words) {
+                            char *base = reinterpret_cast<char *>(x);
+                            for (std::size_t k = 0; k < 4; ++k) {
+                                _mm512_i64scatter_epi64(base + 8 * k, offsets, words[k], 1);
+                            }
+                        }
+
+                        CRYPTO3_FP_IFMA static inline void split(const __m512i *x, __m512i *l) {
+                            const __m512i m = _mm512_set1_epi64(mask);
+                            l[0] = _mm512_and_si512(x[0], m);
+                            l[1] = _mm512_and_si512(
+                                _mm512_or_si512(_mm512_srli_epi64(x[0], 52), _mm512_slli_epi64(x[1], 12)), m);
+                            l[2] = _mm512_and_si512(
+                                _mm512_or_si512(_mm512_srli_epi64(x[1], 40), _mm512_slli_epi64(x[2], 24)), m);
+                            l[3] = _mm512_and_si512(
+                                _mm512_or_si512(_mm512_srli_epi64(x[2], 28), _mm512_slli_epi64(x[3], 36)), m);
+                            l[4] = _mm512_srli_epi64(x[3], 16);
+                        }
+
+                        CRYPTO3_FP_IFMA static inline void split_shifted(const __m512i *x, __m512i *l) {
+                            const __m512i m = _mm512_set1_epi64(mask);
+                            l[0] = _mm512_and_si512(_mm512_slli_epi64(x[0], 4), m);
+                            l[1] = _mm512_and_si512(
+                                _mm512_or_si512(_mm512_srli_epi64(x[0], 48), _mm512_slli_epi64(x[1], 16)), m);
+                            l[2] = _mm512_and_si512(
+                                _mm512_or_si512(_mm512_srli_epi64(x[1], 36), _mm512_slli_epi64(x[2], 28)), m);
+                            l[3] = _mm512_and_si512(
+                                _mm512_or_si512(_mm512_srli_epi64(x[2], 24), _mm512_slli_epi64(x[3], 40)), m);
+                            l[4] = _mm512_srli_epi64(x[3], 12);
+                        }
+
+                        CRYPTO3_FP_IFMA static inline void join(const __m512i *l, __m512i *x) {
+                            x[0] = _mm512_or_si512(l[0], _mm512_slli_epi64(l[1], 52));
+                            x[1] = _mm512_or_si512(_mm512_srli_epi64(l[1], 12), _mm512_slli_epi64(l[2], 40));
+                            x[2] = _mm512_or_si512(_mm512_srli_epi64(l[2], 24), _mm512_slli_epi64(l[3], 28));
+                            x[3] = _mm512_or_si512(_mm512_srli_epi64(l[3], 36), _mm512_slli_epi64(l[4], 16));
+                        }
+
+                        // Word-by-word Montgomery product of the split a and 16 * b, the result is joined back.
+                        CRYPTO3_FP_IFMA inline void montgomery_mul(const __m512i *a, const __m512i *b,
+                                                                   __m512i *result) const {
+                            const __m512i zero = _mm512_setzero_si512();
+                            const __m512i m_mask = _mm512_set1_epi64(mask);
+                            const __m512i p_dash = _mm512_set1_epi64(m_p_dash);
+                            __m512i p[limbs];
+                            for (std::size_t j = 0; j < limbs; ++j) {
+                                p[j] = _mm512_set1_epi64(m_modulus[j]);
+                            }
+
+                            // The lanes hold sums of a few 52-bit halves of products, so they never overflow.
+                            __m512i t[limbs + 1];
+                            for (std::size_t j = 0; j <= limbs; ++j) {
+                                t[j] = zero;
+                            }
+                            for (std::size_t i = 0; i < limbs; ++i) {
+                                for (std::size_t j = 0; j < limbs; ++j) {
+                                    t[j] = _mm512_madd52lo_epu64(t[j], a[j], b[i]);
+                                    t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], a[j], b[i]);
+                                }
+                                const __m512i m = _mm512_madd52lo_epu64(zero, t[0], p_dash);
+                                for (std::size_t j = 0; j < limbs; ++j) {
+                                    t[j] = _mm512_madd52lo_epu64(t[j], m, p[j]);
+                                    t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], m, p[j]);
+                                }
+                                // The low 52 bits of t[0] are zero now, the rest is a carry.
+                                t[1] = _mm512_add_epi64(t[1], _mm512_srli_epi64(t[0], 52));
+                                for (std::size_t j = 0; j < limbs; ++j) {
+                                    t[j] = t[j + 1];
+                                }
+                                t[limbs] = zero;
+                            }
+
+                            for (std::size_t j = 0; j + 1 < limbs; ++j) {
+                                t[j + 1] = _mm512_add_epi64(t[j + 1], _mm512_srli_epi64(t[j], 52));
+                                t[j] = _mm512_and_si512(t[j], m_mask);
+                            }
+
+                            // t - p, keeping t where it borrows.
+                            __m512i d[limbs];
+                            __m512i borrow = zero;
+                            for (std::size_t j = 0; j < limbs; ++j) {
+                                d[j] = _mm512_sub_epi64(_mm512_sub_epi64(t[j], p[j]), borrow);
+                                borrow = _mm512_srli_epi64(d[j], 63);
+                                d[j] = _mm512_and_si512(d[j], m_mask);
+                            }
+                            const __mmask8 keep = _mm512_cmpneq_epi64_mask(borrow, zero);
+                            for (std::size_t j = 0; j < limbs; ++j) {
+                                d[j] = _mm512_mask_mov_epi64(d[j], keep, t[j]);
+                            }
+                            join(d, result);
+                        }
+
+                        CRYPTO3_FP_IFMA static inline __m512i block_offsets(std::size_t stride) {
+                            const long long s = static_cast<long long>(stride);
+                            return _mm512_set_epi64(7 * s, 6 * s, 5 * s, 4 * s, 3 * s, 2 * s, s, 0);
+                        }
+
+                        CRYPTO3_FP_IFMA std::size_t mul_ifma(std::uint64_t *r, const std::uint64_t *a,
+                                                             const std::uint64_t *b, std::size_t stride,
+                                                             std::size_t n) const {
+                            const __m512i offsets = block_offsets(stride);
+                            const std::size_t words = stride / sizeof(std::uint64_t);
+                            std::size_t i = 0;
+                            for (; i + 8 <= n; i += 8) {
+                                __m512i x[4], y[4], a_limbs[limbs], b_limbs[limbs];
+                                load(a + i * words, offsets, x);
+                                load(b + i * words, offsets, y);
+                                split(x, a_limbs);
+                                split_shifted(y, b_limbs);
+                                montgomery_mul(a_limbs, b_limbs, x);
+                                store(r + i * words, offsets, x);
+                            }
+                            return i;
+                        }
+
+                        CRYPTO3_FP_IFMA std::size_t mul_constant_ifma(std::uint64_t *r, const std::uint64_t *a,
+                                                                      const std::uint64_t *b, std::size_t stride,
+                                                                      std::size_t n) const {
+                            const __m512i offsets = block_offsets(stride);
+                            const std::size_t words = stride / sizeof(std::uint64_t);
+                            std::uint64_t b_split[limbs];
+                            split_shifted(b, b_split);
+                            __m512i b_limbs[limbs];
+                            for (std::size_t j = 0; j < limbs; ++j) {
+                                b_limbs[j] = _mm512_set1_epi64(b_split[j]);
+                            }
+                            std::size_t i = 0;
+                            for (; i + 8 <= n; i += 8) {
+                                __m512i x[4], a_limbs[limbs];
+                                load(a + i * words, offsets, x);
+                                split(x, a_limbs);
+                                montgomery_mul(a_limbs, b_limbs, x);
+                                store(r + i * words, offsets, x);
+                            }
+                            return i;
+                        }
+#endif
+
+                        std::uint64_t m_modulus[limbs];
+                        std::uint64_t m_p_dash;
+                    };
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#ifdef CRYPTO3_ALGEBRA_FIELDS_X86_DISPATCH
+#undef CRYPTO3_FP_IFMA
+#endif
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FP_IFMA_ARITHMETIC_HPP
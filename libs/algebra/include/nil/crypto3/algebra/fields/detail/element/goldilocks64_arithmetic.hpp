@@ -0,0 +1,145 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Arithmetic modulo the Goldilocks prime p = 2^64 - 2^32 + 1 on canonical 64-bit words.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_ELEMENT_GOLDILOCKS64_ARITHMETIC_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_ELEMENT_GOLDILOCKS64_ARITHMETIC_HPP
+
+#include <cstdint>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+
+                    /**
+                     * Word-level arithmetic modulo p = 2^64 - 2^32 + 1. All the inputs and outputs are canonical,
+                     * i.e. lie in [0, p).
+                     *
+                     * The special form of p gives 2^64 = 2^32 - 1 (mod p) and 2^96 = -1 (mod p), so a 128-bit
+                     * product is reduced with a few additions and shifts instead of a Montgomery reduction.
+                     */
+                    struct goldilocks64_arithmetic {
+                        constexpr static const std::uint64_t modulus = 0xFFFFFFFF00000001ULL;
+                        // 2^64 - p = 2^32 - 1
+                        constexpr static const std::uint64_t epsilon = 0xFFFFFFFFULL;
+
+                        constexpr static std::uint64_t reduce64(std::uint64_t a) {
+                            return a >= modulus ? a - modulus : a;
+                        }
+
+                        constexpr static std::uint64_t add(std::uint64_t a, std::uint64_t b) {
+                            std::uint64_t sum = a + b;
+                            // On overflow the dropped 2^64 equals epsilon, and the result is already below p.
+                            if (sum < a) {
+                                return sum + epsilon;
+                            }
+                            return reduce64(sum);
+                        }
+
+                        constexpr static std::uint64_t sub(std::uint64_t a, std::uint64_t b) {
+                            std::uint64_t diff = a - b;
+                            // On borrow 2^64 was added, p = 2^64 - epsilon is what we need.
+                            if (a < b) {
+                                diff -= epsilon;
+                            }
+                            return diff;
+                        }
+
+                        constexpr static std::uint64_t neg(std::uint64_t a) {
+                            return a == 0 ? 0 : modulus - a;
+                        }
+
+                        // Reduces hi * 2^64 + lo.
+                        constexpr static std::uint64_t reduce128(std::uint64_t lo, std::uint64_t hi) {
+                            const std::uint64_t hi_hi = hi >> 32;
+                            const std::uint64_t hi_lo = hi & epsilon;
+
+                            // lo - hi_hi * 2^96 = lo + hi_hi
+                            std::uint64_t t0 = lo - hi_hi;
+                            if (lo < hi_hi) {
+                                t0 -= epsilon;
+                            }
+                            // hi_lo * 2^64 = hi_lo * epsilon, which fits into 64 bits.
+                            const std::uint64_t t1 = (hi_lo << 32) - hi_lo;
+                            std::uint64_t t2 = t0 + t1;
+                            if (t2 < t1) {
+                                t2 += epsilon;
+                            }
+                            return reduce64(t2);
+                        }
+
+                        constexpr static std::uint64_t mul(std::uint64_t a, std::uint64_t b) {
+                            const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+                            return reduce128(static_cast<std::uint64_t>(product),
+                                             static_cast<std::uint64_t>(product >> 64));
+                        }
+
+                        constexpr static std::uint64_t square(std::uint64_t a) {
+                            return mul(a, a);
+                        }
+
+                        constexpr static std::uint64_t pow(std::uint64_t a, std::uint64_t power) {
+                            std::uint64_t result = 1;
+                            while (power != 0) {
+                                if (power & 1) {
+                                    result = mul(result, a);
+                                }
+                                a = square(a);
+                                power >>= 1;
+                            }
+                            return result;
+                        }
+
+                        // a^(2^k)
+                        constexpr static std::uint64_t square_n(std::uint64_t a, unsigned k) {
+                            for (unsigned i = 0; i < k; ++i) {
+                                a = square(a);
+                            }
+                            return a;
+                        }
+
+                        // a^(p - 2), zero is mapped to zero.
+                        constexpr static std::uint64_t inverse(std::uint64_t a) {
+                            // p - 2 = (2^31 - 1) * 2^33 + (2^32 - 1), t_k below stands for a^(2^k - 1).
+                            const std::uint64_t t2 = mul(square(a), a);
+                            const std::uint64_t t3 = mul(square(t2), a);
+                            const std::uint64_t t6 = mul(square_n(t3, 3), t3);
+                            const std::uint64_t t12 = mul(square_n(t6, 6), t6);
+                            const std::uint64_t t24 = mul(square_n(t12, 12), t12);
+                            const std::uint64_t t30 = mul(square_n(t24, 6), t6);
+                            const std::uint64_t t31 = mul(square(t30), a);
+                            const std::uint64_t t32 = mul(square(t31), a);
+                            return mul(square_n(t31, 33), t32);
+                        }
+                    };
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_ELEMENT_GOLDILOCKS64_ARITHMETIC_HPP
@@ -25,7 +25,18 @@
 #ifndef CRYPTO3_ALGEBRA_FIELDS_GOLDILOCKS64_BASE_FIELD_HPP
 #define CRYPTO3_ALGEBRA_FIELDS_GOLDILOCKS64_BASE_FIELD_HPP
 
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include <boost/multiprecision/number.hpp>
+
 #include <nil/crypto3/algebra/fields/detail/element/fp.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/goldilocks64_arithmetic.hpp>
 
 #include <nil/crypto3/algebra/fields/params.hpp>
 #include <nil/crypto3/algebra/fields/field.hpp>
@@ -80,6 +91,281 @@ namespace nil {
                 constexpr
                     typename goldilocks64_base_field::modular_params_type const goldilocks64_base_field::modulus_params;
 #endif
+
+#ifndef __ZKLLVM__
+                namespace detail {
+                    /**
+                     * Goldilocks field element stored as a canonical 64-bit word. The arithmetic uses the
+                     * special-form reduction of goldilocks64_arithmetic instead of the generic Montgomery
+                     * backend, the interface is the one of the generic element_fp. The elements have the layout
+                     * of std::uint64_t, so arrays of them can be passed to the vectorized kernels.
+                     */
+                    template<>
+                    class element_fp<params<goldilocks64_base_field>> {
+                        typedef params<goldilocks64_base_field> policy_type;
+                        typedef goldilocks64_arithmetic arithmetic_type;
+
+                    public:
+                        typedef typename policy_type::field_type field_type;
+
+                        typedef typename policy_type::modular_type modular_type;
+                        typedef typename policy_type::integral_type integral_type;
+                        typedef typename policy_type::modular_backend modular_backend;
+                        typedef typename policy_type::modular_params_type modular_params_type;
+
+                        constexpr static const modular_params_type modulus_params = policy_type::modulus_params;
+                        constexpr static const integral_type modulus = policy_type::modulus;
+
+                        using data_type = std::uint64_t;
+                        data_type data;
+
+                        constexpr element_fp() : data(0) {}
+
+                        // Integral numbers of any width are reduced modulo p, e.g. the transcript challenges.
+                        template<unsigned Bits, boost::multiprecision::expression_template_option ExpressionTemplates>
+                        element_fp(const boost::multiprecision::number<
+                                   boost::multiprecision::backends::cpp_int_modular_backend<Bits>, ExpressionTemplates> &value)
+                                : data(0) {
+                            std::vector<std::uint64_t> words;
+                            boost::multiprecision::export_bits(value, std::back_inserter(words), 64);
+                            // Horner's rule over the 64-bit words, the most significant one first.
+                            for (std::uint64_t word : words) {
+                                data = arithmetic_type::reduce128(word, data);
+                            }
+                        }
+
+                        element_fp(const modular_type &value)
+                                : data(static_cast<data_type>(integral_type(value))) {}
+
+                        template<typename Number, typename std::enable_if<
+                                std::is_integral<Number>::value && std::is_signed<Number>::value, bool>::type = true>
+                        constexpr element_fp(const Number &value)
+                                : data(value < 0 ?
+                                       arithmetic_type::neg(arithmetic_type::reduce64(
+                                           static_cast<std::uint64_t>(-(value + 1)) + 1)) :
+                                       arithmetic_type::reduce64(static_cast<std::uint64_t>(value))) {}
+
+                        template<typename Number, typename std::enable_if<
+                                std::is_integral<Number>::value && !std::is_signed<Number>::value, bool>::type = true>
+                        constexpr element_fp(const Number &value)
+                                : data(arithmetic_type::reduce64(static_cast<std::uint64_t>(value))) {}
+
+                        constexpr element_fp(const element_fp &B) = default;
+
+                        constexpr element_fp &operator=(const element_fp &B) = default;
+
+                        constexpr static const element_fp &zero();
+
+                        constexpr static const element_fp &one();
+
+                        constexpr bool is_zero() const {
+                            return data == 0;
+                        }
+
+                        constexpr bool is_one() const {
+                            return data == 1;
+                        }
+
+                        constexpr bool operator==(const element_fp &B) const {
+                            return data == B.data;
+                        }
+
+                        constexpr bool operator!=(const element_fp &B) const {
+                            return data != B.data;
+                        }
+
+                        constexpr element_fp operator+(const element_fp &B) const {
+                            return from_data(arithmetic_type::add(data, B.data));
+                        }
+
+                        constexpr element_fp operator-(const element_fp &B) const {
+                            return from_data(arithmetic_type::sub(data, B.data));
+                        }
+
+                        constexpr element_fp &operator-=(const element_fp &B) {
+                            data = arithmetic_type::sub(data, B.data);
+                            return *this;
+                        }
+
+                        constexpr element_fp &operator+=(const element_fp &B) {
+                            data = arithmetic_type::add(data, B.data);
+                            return *this;
+                        }
+
+                        constexpr element_fp &operator*=(const element_fp &B) {
+                            data = arithmetic_type::mul(data, B.data);
+                            return *this;
+                        }
+
+                        constexpr element_fp &operator/=(const element_fp &B) {
+                            data = arithmetic_type::mul(data, arithmetic_type::inverse(B.data));
+                            return *this;
+                        }
+
+                        constexpr element_fp operator-() const {
+                            return from_data(arithmetic_type::neg(data));
+                        }
+
+                        constexpr void negate_inplace() {
+                            data = arithmetic_type::neg(data);
+                        }
+
+                        constexpr element_fp operator/(const element_fp &B) const {
+                            return from_data(arithmetic_type::mul(data, arithmetic_type::inverse(B.data)));
+                        }
+
+                        constexpr element_fp operator*(const element_fp &B) const {
+                            return from_data(arithmetic_type::mul(data, B.data));
+                        }
+
+                        constexpr bool operator<(const element_fp &B) const {
+                            return data < B.data;
+                        }
+
+                        constexpr bool operator>(const element_fp &B) const {
+                            return data > B.data;
+                        }
+
+                        constexpr bool operator<=(const element_fp &B) const {
+                            return data <= B.data;
+                        }
+
+                        constexpr bool operator>=(const element_fp &B) const {
+                            return data >= B.data;
+                        }
+
+                        constexpr element_fp &operator++() {
+                            data = arithmetic_type::add(data, 1);
+                            return *this;
+                        }
+
+                        constexpr element_fp operator++(int) {
+                            element_fp temp(*this);
+                            ++*this;
+                            return temp;
+                        }
+
+                        constexpr element_fp &operator--() {
+                            data = arithmetic_type::sub(data, 1);
+                            return *this;
+                        }
+
+                        constexpr element_fp operator--(int) {
+                            element_fp temp(*this);
+                            --*this;
+                            return temp;
+                        }
+
+                        constexpr element_fp doubled() const {
+                            return from_data(arithmetic_type::add(data, data));
+                        }
+
+                        constexpr void double_inplace() {
+                            data = arithmetic_type::add(data, data);
+                        }
+
+                        // If the element does not have a square root, this function must not be called.
+                        // Call is_square() before using this function.
+                        constexpr element_fp sqrt() const {
+                            if (this->is_zero())
+                                return zero();
+                            // Tonelli-Shanks for p - 1 = 2^32 * (2^32 - 1), 7 generates the multiplicative group.
+                            constexpr const std::uint64_t odd_part = 0xFFFFFFFFULL;
+                            std::uint64_t m = 32;
+                            std::uint64_t c = arithmetic_type::pow(7, odd_part);
+                            std::uint64_t t = arithmetic_type::pow(data, odd_part);
+                            std::uint64_t r = arithmetic_type::pow(data, (odd_part + 1) / 2);
+                            while (t != 1) {
+                                std::uint64_t i = 0;
+                                for (std::uint64_t t_power = t; t_power != 1 && i < m; ++i) {
+                                    t_power = arithmetic_type::square(t_power);
+                                }
+                                assert(i < m);
+                                std::uint64_t b = arithmetic_type::square_n(c, m - i - 1);
+                                m = i;
+                                c = arithmetic_type::square(b);
+                                t = arithmetic_type::mul(t, c);
+                                r = arithmetic_type::mul(r, b);
+                            }
+                            return from_data(r);
+                        }
+
+                        constexpr element_fp inversed() const {
+                            return from_data(arithmetic_type::inverse(data));
+                        }
+
+                        constexpr element_fp squared() const {
+                            return from_data(arithmetic_type::square(data));
+                        }
+
+                        constexpr element_fp &square_inplace() {
+                            data = arithmetic_type::square(data);
+                            return *this;
+                        }
+
+                        constexpr bool is_square() const {
+                            element_fp tmp = this->pow((arithmetic_type::modulus - 1) / 2);
+                            return (tmp.is_one() || tmp.is_zero());
+                        }
+
+                        template<typename PowerType,
+                                typename = typename std::enable_if<boost::is_integral<PowerType>::value>::type>
+                        constexpr element_fp pow(const PowerType pwr) const {
+                            return from_data(arithmetic_type::pow(data, static_cast<std::uint64_t>(pwr)));
+                        }
+
+                        template<typename Backend, boost::multiprecision::expression_template_option ExpressionTemplates>
+                        constexpr element_fp
+                        pow(const boost::multiprecision::number<Backend, ExpressionTemplates> &pwr) const {
+                            if (pwr.is_zero()) {
+                                return one();
+                            }
+                            std::uint64_t result = 1;
+                            for (std::size_t i = boost::multiprecision::msb(pwr) + 1; i-- > 0;) {
+                                result = arithmetic_type::square(result);
+                                if (boost::multiprecision::bit_test(pwr, i)) {
+                                    result = arithmetic_type::mul(result, data);
+                                }
+                            }
+                            return from_data(result);
+                        }
+
+                    private:
+                        constexpr static element_fp from_data(data_type value) {
+                            element_fp result;
+                            result.data = value;
+                            return result;
+                        }
+                    };
+
+                    constexpr typename element_fp<params<goldilocks64_base_field>>::integral_type const
+                        element_fp<params<goldilocks64_base_field>>::modulus;
+
+                    constexpr typename element_fp<params<goldilocks64_base_field>>::modular_params_type const
+                        element_fp<params<goldilocks64_base_field>>::modulus_params;
+
+                    // The instances are the ones of the generic element_fp, created from the integral zero and one.
+                    constexpr const element_fp<params<goldilocks64_base_field>> &
+                        element_fp<params<goldilocks64_base_field>>::zero() {
+                        return element_fp_details::zero_instance<params<goldilocks64_base_field>>;
+                    }
+
+                    constexpr const element_fp<params<goldilocks64_base_field>> &
+                        element_fp<params<goldilocks64_base_field>>::one() {
+                        return element_fp_details::one_instance<params<goldilocks64_base_field>>;
+                    }
+
+                    static_assert(sizeof(element_fp<params<goldilocks64_base_field>>) == sizeof(std::uint64_t),
+                                  "Goldilocks elements must have the layout of a 64-bit word.");
+
+                    inline std::ostream &operator<<(std::ostream &os,
+                                                    const element_fp<params<goldilocks64_base_field>> &elem) {
+                        os << typename goldilocks64_base_field::integral_type(elem.data);
+                        return os;
+                    }
+                }    // namespace detail
+#endif
+
                 using goldilocks64_fq = goldilocks64_base_field;
 
                 using goldilocks64 = goldilocks64_base_field;
@@ -89,4 +375,16 @@ namespace nil {
     }            // namespace crypto3
 }    // namespace nil
 
+#ifndef __ZKLLVM__
+template<>
+struct std::hash<nil::crypto3::algebra::fields::detail::element_fp<
+    nil::crypto3::algebra::fields::params<nil::crypto3::algebra::fields::goldilocks64_base_field>>> {
+    size_t operator()(const nil::crypto3::algebra::fields::detail::element_fp<
+                      nil::crypto3::algebra::fields::params<nil::crypto3::algebra::fields::goldilocks64_base_field>>
+                          &elem) const {
+        return std::hash<std::uint64_t>()(elem.data);
+    }
+};
+#endif
+
 #endif    // CRYPTO3_ALGEBRA_FIELDS_GOLDILOCKS64_BASE_FIELD_HPP
@@ -0,0 +1,386 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Element-wise Goldilocks arithmetic over contiguous arrays, vectorized with AVX-512 or AVX2 when the CPU
+// supports them.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_GOLDILOCKS64_VECTOR_ARITHMETIC_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_GOLDILOCKS64_VECTOR_ARITHMETIC_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <nil/crypto3/algebra/fields/goldilocks64/base_field.hpp>
+#include <nil/crypto3/algebra/fields/detail/cpu_features.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/goldilocks64_arithmetic.hpp>
+
+#ifdef CRYPTO3_ALGEBRA_FIELDS_X86_DISPATCH
+#include <immintrin.h>
+
+#define CRYPTO3_GOLDILOCKS64_AVX2 __attribute__((target("avx2")))
+#define CRYPTO3_GOLDILOCKS64_AVX512 __attribute__((target("avx512f")))
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+
+                /**
+                 * r[i] = a[i] op b[i] for i in [0, n) over canonical Goldilocks words. The output may alias
+                 * any of the inputs. The widest instruction set supported by the CPU is picked at runtime, the
+                 * tails and the other targets fall back to the scalar goldilocks64_arithmetic.
+                 */
+                struct goldilocks64_vector_arithmetic {
+                    typedef typename goldilocks64_base_field::value_type value_type;
+                    typedef detail::goldilocks64_arithmetic scalar_type;
+
+                    static inline void add(std::uint64_t *r, const std::uint64_t *a, const std::uint64_t *b,
+                                           std::size_t n) {
+                        std::size_t i = 0;
+#ifdef CRYPTO3_ALGEBRA_FIELDS_X86_DISPATCH
+                        if (detail::has_avx512f()) {
+                            i = add_avx512(r, a, b, n);
+                        } else if (detail::has_avx2()) {
+                            i = add_avx2(r, a, b, n);
+                        }
+#endif
+                        for (; i < n; ++i) {
+                            r[i] = scalar_type::add(a[i], b[i]);
+                        }
+                    }
+
+                    static inline void sub(std::uint64_t *r, const std::uint64_t *a, const std::uint64_t *b,
+                                           std::size_t n) {
+                        std::size_t i = 0;
+#ifdef CRYPTO3_ALGEBRA_FIELDS_X86_DISPATCH
+                        if (detail::has_avx512f()) {
+                            i = sub_avx512(r, a, b, n);
+                        } else if (detail::has_avx2()) {
+                            i = sub_avx2(r, a, b, n);
+                        }
+#endif
+                        for (; i < n; ++i) {
+                            r[i] = scalar_type::sub(a[i], b[i]);
+                        }
+                    }
+
+                    static inline void mul(std::uint64_t *r, const std::uint64_t *a, const std::uint64_t *b,
+                                           std::size_t n) {
+                        std::size_t i = 0;
+#ifdef CRYPTO3_ALGEBRA_FIELDS_X86_DISPATCH
+                        if (detail::has_avx512f()) {
+                            i = mul_avx512(r, a, b, n);
+                        } else if (detail::has_avx2()) {
+                            i = mul_avx2(r, a, b, n);
+                        }
+#endif
+                        for (; i < n; ++i) {
+                            r[i] = scalar_type::mul(a[i], b[i]);
+                        }
+                    }
+
+                    // r[i] = a[i] * b
+                    static inline void mul(std::uint64_t *r, const std::uint64_t *a, std::uint64_t b, std::size_t n) {
+                        std::size_t i = 0;
+#ifdef CRYPTO3_ALGEBRA_FIELDS_X86_DISPATCH
+                        if (detail::has_avx512f()) {
+                            i = mul_avx512(r, a, b, n);
+                        } else if (detail::has_avx2()) {
+                            i = mul_avx2(r, a, b, n);
+                        }
+#endif
+                        for (; i < n; ++i) {
+                            r[i] = scalar_type::mul(a[i], b);
+                        }
+                    }
+
+                    // t = w[i] * y[i], then y[i] = x[i] - t and x[i] = x[i] + t.
+                    static inline void butterfly(std::uint64_t *x, std::uint64_t *y, const std::uint64_t *w,
+                                                 std::size_t n) {
+                        std::size_t i = 0;
+#ifdef CRYPTO3_ALGEBRA_FIELDS_X86_DISPATCH
+                        if (detail::has_avx512f()) {
+                            i = butterfly_avx512(x, y, w, n);
+                        } else if (detail::has_avx2()) {
+                            i = butterfly_avx2(x, y, w, n);
+                        }
+#endif
+                        for (; i < n; ++i) {
+                            const std::uint64_t t = scalar_type::mul(w[i], y[i]);
+                            y[i] = scalar_type::sub(x[i], t);
+                            x[i] = scalar_type::add(x[i], t);
+                        }
+                    }
+
+                    static inline void add(value_type *r, const value_type *a, const value_type *b, std::size_t n) {
+                        add(words(r), words(a), words(b), n);
+                    }
+
+                    static inline void sub(value_type *r, const value_type *a, const value_type *b, std::size_t n) {
+                        sub(words(r), words(a), words(b), n);
+                    }
+
+                    static inline void mul(value_type *r, const value_type *a, const value_type *b, std::size_t n) {
+                        mul(words(r), words(a), words(b), n);
+                    }
+
+                    static inline void mul(value_type *r, const value_type *a, const value_type &b, std::size_t n) {
+                        mul(words(r), words(a), b.data, n);
+                    }
+
+                    static inline void butterfly(value_type *x, value_type *y, const value_type *w, std::size_t n) {
+                        butterfly(words(x), words(y), words(w), n);
+                    }
+
+                private:
+                    // The elements have the layout of their single 64-bit word.
+                    static inline std::uint64_t *words(value_type *elements) {
+                        return reinterpret_cast<std::uint64_t *>(elements);
+                    }
+
+                    static inline const std::uint64_t *words(const value_type *elements) {
+                        return reinterpret_cast<const std::uint64_t *>(elements);
+                    }
+
+#ifdef CRYPTO3_ALGEBRA_FIELDS_X86_DISPATCH
+                    // The array kernels below process the longest prefix of whole vectors and return its length.
+
+                    CRYPTO3_GOLDILOCKS64_AVX512 static inline __m512i canonicalize8(__m512i x) {
+                        const __m512i p = _mm512_set1_epi64(static_cast<long long>(scalar_type::modulus));
+                        return _mm512_mask_sub_epi64(x, _mm512_cmpge_epu64_mask(x, p), x, p);
+                    }
+
+                    CRYPTO3_GOLDILOCKS64_AVX512 static inline __m512i add8(__m512i a, __m512i b) {
+                        const __m512i epsilon = _mm512_set1_epi64(static_cast<long long>(scalar_type::epsilon));
+                        __m512i sum = _mm512_add_epi64(a, b);
+                        sum = _mm512_mask_add_epi64(sum, _mm512_cmplt_epu64_mask(sum, a), sum, epsilon);
+                        return canonicalize8(sum);
+                    }
+
+                    CRYPTO3_GOLDILOCKS64_AVX512 static inline __m512i sub8(__m512i a, __m512i b) {
+                        const __m512i epsilon = _mm512_set1_epi64(static_cast<long long>(scalar_type::epsilon));
+                        __m512i diff = _mm512_sub_epi64(a, b);
+                        return _mm512_mask_sub_epi64(diff, _mm512_cmplt_epu64_mask(a, b), diff, epsilon);
+                    }
+
+                    CRYPTO3_GOLDILOCKS64_AVX512 static inline __m512i mul8(__m512i a, __m512i b) {
+                        const __m512i epsilon = _mm512_set1_epi64(static_cast<long long>(scalar_type::epsilon));
+
+                        // 64 x 64 -> 128 bit products from the 32 x 32 -> 64 bit ones.
+                        const __m512i a_hi = _mm512_srli_epi64(a, 32);
+                        const __m512i b_hi = _mm512_srli_epi64(b, 32);
+                        const __m512i ll = _mm512_mul_epu32(a, b);
+                        const __m512i lh = _mm512_mul_epu32(a, b_hi);
+                        const __m512i hl = _mm512_mul_epu32(a_hi, b);
+                        const __m512i hh = _mm512_mul_epu32(a_hi, b_hi);
+                        const __m512i t = _mm512_add_epi64(hl, _mm512_srli_epi64(ll, 32));
+                        const __m512i u = _mm512_add_epi64(lh, _mm512_and_si512(t, epsilon));
+                        const __m512i lo = _mm512_or_si512(_mm512_slli_epi64(u, 32), _mm512_and_si512(ll, epsilon));
+                        const __m512i hi = _mm512_add_epi64(
+                            _mm512_add_epi64(hh, _mm512_srli_epi64(t, 32)), _mm512_srli_epi64(u, 32));
+
+                        // Same reduction as goldilocks64_arithmetic::reduce128.
+                        const __m512i hi_hi = _mm512_srli_epi64(hi, 32);
+                        const __m512i hi_lo = _mm512_and_si512(hi, epsilon);
+                        __m512i t0 = _mm512_sub_epi64(lo, hi_hi);
+                        t0 = _mm512_mask_sub_epi64(t0, _mm512_cmplt_epu64_mask(lo, hi_hi), t0, epsilon);
+                        const __m512i t1 = _mm512_sub_epi64(_mm512_slli_epi64(hi_lo, 32), hi_lo);
+                        __m512i t2 = _mm512_add_epi64(t0, t1);
+                        t2 = _mm512_mask_add_epi64(t2, _mm512_cmplt_epu64_mask(t2, t1), t2, epsilon);
+                        return canonicalize8(t2);
+                    }
+
+                    CRYPTO3_GOLDILOCKS64_AVX512 static std::size_t add_avx512(std::uint64_t *r, const std::uint64_t *a,
+                                                                            const std::uint64_t *b, std::size_t n) {
+                        std::size_t i = 0;
+                        for (; i + 8 <= n; i += 8) {
+                            _mm512_storeu_si512(r + i, add8(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i)));
+                        }
+                        return i;
+                    }
+
+                    CRYPTO3_GOLDILOCKS64_AVX512 static std::size_t sub_avx512(std::uint64_t *r, const std::uint64_t *a,
+                                                                            const std::uint64_t *b, std::size_t n) {
+                        std::size_t i = 0;
+                        for (; i + 8 <= n; i += 8) {
+                            _mm512_storeu_si512(r + i, sub8(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i)));
+                        }
+                        return i;
+                    }
+
+                    CRYPTO3_GOLDILOCKS64_AVX512 static std::size_t mul_avx512(std::uint64_t *r, const std::uint64_t *a,
+                                                                            const std::uint64_t *b, std::size_t n) {
+                        std::size_t i = 0;
+                        for (; i + 8 <= n; i += 8) {
+                            _mm512_storeu_si512(r + i, mul8(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i)));
+                        }
+                        return i;
+                    }
+
+                    CRYPTO3_GOLDILOCKS64_AVX512 static std::size_t mul_avx512(std::uint64_t *r, const std::uint64_t *a,
+                                                                            std::uint64_t b, std::size_t n) {
+                        const __m512i b_vector = _mm512_set1_epi64(static_cast<long long>(b));
+                        std::size_t i = 0;
+                        for (; i + 8 <= n; i += 8) {
+                            _mm512_storeu_si512(r + i, mul8(_mm512_loadu_si512(a + i), b_vector));
+                        }
+                        return i;
+                    }
+
+                    CRYPTO3_GOLDILOCKS64_AVX512 static std::size_t butterfly_avx512(std::uint64_t *x, std::uint64_t *y,
+                                                                                  const std::uint64_t *w,
+                                                                                  std::size_t n) {
+                        std::size_t i = 0;
+                        for (; i + 8 <= n; i += 8) {
+                            const __m512i x_vector = _mm512_loadu_si512(x + i);
+                            const __m512i t = mul8(_mm512_loadu_si512(w + i), _mm512_loadu_si512(y + i));
+                            _mm512_storeu_si512(y + i, sub8(x_vector, t));
+                            _mm512_storeu_si512(x + i, add8(x_vector, t));
+                        }
+                        return i;
+                    }
+
+                    CRYPTO3_GOLDILOCKS64_AVX2 static inline __m256i load4(const std::uint64_t *p) {
+                        return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+                    }
+
+                    CRYPTO3_GOLDILOCKS64_AVX2 static inline void store4(std::uint64_t *p, __m256i x) {
+                        _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), x);
+                    }
+
+                    // AVX2 has signed comparisons only, x ^ 2^63 maps the unsigned order onto the signed one.
+                    // Returns all ones in the lanes where a < b as unsigned.
+                    CRYPTO3_GOLDILOCKS64_AVX2 static inline __m256i less4(__m256i a, __m256i b) {
+                        const __m256i sign = _mm256_set1_epi64x(static_cast<long long>(1ULL << 63));
+                        return _mm256_cmpgt_epi64(_mm256_xor_si256(b, sign), _mm256_xor_si256(a, sign));
+                    }
+
+                    CRYPTO3_GOLDILOCKS64_AVX2 static inline __m256i canonicalize4(__m256i x) {
+                        const __m256i p = _mm256_set1_epi64x(static_cast<long long>(scalar_type::modulus));
+                        // x >= p is the same as !(x < p)
+                        return _mm256_sub_epi64(x, _mm256_andnot_si256(less4(x, p), p));
+                    }
+
+                    CRYPTO3_GOLDILOCKS64_AVX2 static inline __m256i add4(__m256i a, __m256i b) {
+                        const __m256i epsilon = _mm256_set1_epi64x(static_cast<long long>(scalar_type::epsilon));
+                        __m256i sum = _mm256_add_epi64(a, b);
+                        sum = _mm256_add_epi64(sum, _mm256_and_si256(less4(sum, a), epsilon));
+                        return canonicalize4(sum);
+                    }
+
+                    CRYPTO3_GOLDILOCKS64_AVX2 static inline __m256i sub4(__m256i a, __m256i b) {
+                        const __m256i epsilon = _mm256_set1_epi64x(static_cast<long long>(scalar_type::epsilon));
+                        const __m256i diff = _mm256_sub_epi64(a, b);
+                        return _mm256_sub_epi64(diff, _mm256_and_si256(less4(a, b), epsilon));
+                    }
+
+                    CRYPTO3_GOLDILOCKS64_AVX2 static inline __m256i mul4(__m256i a, __m256i b) {
+                        const __m256i epsilon = _mm256_set1_epi64x(static_cast<long long>(scalar_type::epsilon));
+
+                        // 64 x 64 -> 128 bit products from the 32 x 32 -> 64 bit ones.
+                        const __m256i a_hi = _mm256_srli_epi64(a, 32);
+                        const __m256i b_hi = _mm256_srli_epi64(b, 32);
+                        const __m256i ll = _mm256_mul_epu32(a, b);
+                        const __m256i lh = _mm256_mul_epu32(a, b_hi);
+                        const __m256i hl = _mm256_mul_epu32(a_hi, b);
+                        const __m256i hh = _mm256_mul_epu32(a_hi, b_hi);
+                        const __m256i t = _mm256_add_epi64(hl, _mm256_srli_epi64(ll, 32));
+                        const __m256i u = _mm256_add_epi64(lh, _mm256_and_si256(t, epsilon));
+                        const __m256i lo = _mm256_or_si256(_mm256_slli_epi64(u, 32), _mm256_and_si256(ll, epsilon));
+                        const __m256i hi = _mm256_add_epi64(
+                            _mm256_add_epi64(hh, _mm256_srli_epi64(t, 32)), _mm256_srli_epi64(u, 32));
+
+                        // Same reduction as goldilocks64_arithmetic::reduce128.
+                        const __m256i hi_hi = _mm256_srli_epi64(hi, 32);
+                        const __m256i hi_lo = _mm256_and_si256(hi, epsilon);
+                        __m256i t0 = _mm256_sub_epi64(lo, hi_hi);
+                        t0 = _mm256_sub_epi64(t0, _mm256_and_si256(less4(lo, hi_hi), epsilon));
+                        const __m256i t1 = _mm256_sub_epi64(_mm256_slli_epi64(hi_lo, 32), hi_lo);
+                        __m256i t2 = _mm256_add_epi64(t0, t1);
+                        t2 = _mm256_add_epi64(t2, _mm256_and_si256(less4(t2, t1), epsilon));
+                        return canonicalize4(t2);
+                    }
+
+                    CRYPTO3_GOLDILOCKS64_AVX2 static std::size_t add_avx2(std::uint64_t *r, const std::uint64_t *a,
+                                                                        const std::uint64_t *b, std::size_t n) {
+                        std::size_t i = 0;
+                        for (; i + 4 <= n; i += 4) {
+                            store4(r + i, add4(load4(a + i), load4(b + i)));
+                        }
+                        return i;
+                    }
+
+                    CRYPTO3_GOLDILOCKS64_AVX2 static std::size_t sub_avx2(std::uint64_t *r, const std::uint64_t *a,
+                                                                        const std::uint64_t *b, std::size_t n) {
+                        std::size_t i = 0;
+                        for (; i + 4 <= n; i += 4) {
+                            store4(r + i, sub4(load4(a + i), load4(b + i)));
+                        }
+                        return i;
+                    }
+
+                    CRYPTO3_GOLDILOCKS64_AVX2 static std::size_t mul_avx2(std::uint64_t *r, const std::uint64_t *a,
+                                                                        const std::uint64_t *b, std::size_t n) {
+                        std::size_t i = 0;
+                        for (; i + 4 <= n; i += 4) {
+                            store4(r + i, mul4(load4(a + i), load4(b + i)));
+                        }
+                        return i;
+                    }
+
+                    CRYPTO3_GOLDILOCKS64_AVX2 static std::size_t mul_avx2(std::uint64_t *r, const std::uint64_t *a,
+                                                                        std::uint64_t b, std::size_t n) {
+                        const __m256i b_vector = _mm256_set1_epi64x(static_cast<long long>(b));
+                        std::size_t i = 0;
+                        for (; i + 4 <= n; i += 4) {
+                            store4(r + i, mul4(load4(a + i), b_vector));
+                        }
+                        return i;
+                    }
+
+                    CRYPTO3_GOLDILOCKS64_AVX2 static std::size_t butterfly_avx2(std::uint64_t *x, std::uint64_t *y,
+                                                                              const std::uint64_t *w, std::size_t n) {
+                        std::size_t i = 0;
+                        for (; i + 4 <= n; i += 4) {
+                            const __m256i x_vector = load4(x + i);
+                            const __m256i t = mul4(load4(w + i), load4(y + i));
+                            store4(y + i, sub4(x_vector, t));
+                            store4(x + i, add4(x_vector, t));
+                        }
+                        return i;
+                    }
+#endif
+                };
+            }    // namespace fields
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+
+#ifdef CRYPTO3_ALGEBRA_FIELDS_X86_DISPATCH
+#undef CRYPTO3_GOLDILOCKS64_AVX512
+#undef CRYPTO3_GOLDILOCKS64_AVX2
+#endif
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_GOLDILOCKS64_VECTOR_ARITHMETIC_HPP
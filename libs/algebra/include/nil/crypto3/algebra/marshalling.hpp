@@ -106,8 +106,7 @@ namespace nil {
                     BOOST_ASSERT(field_octets_num == std::distance(out_first, out_last));
 
                     ::boost::multiprecision::export_bits(
-                        element.data.template convert_to<typename FieldType::integral_type>(), out_first, chunk_size,
-                        false);
+                        typename FieldType::integral_type(element.data), out_first, chunk_size, false);
 
                     return field_octets_num;
                 }
@@ -0,0 +1,213 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef CRYPTO3_ALGEBRA_FIXED_BASE_MULTIEXP_HPP
+#define CRYPTO3_ALGEBRA_FIXED_BASE_MULTIEXP_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include <boost/assert.hpp>
+#include <boost/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
+
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+
+            /**
+             * Precomputed multiples of a fixed set of bases for fixed-base multi-scalar multiplication.
+             * For the window size c, points[i * windows_count + j] = 2^(c * j) * bases[i], so a multiexp against
+             * these bases needs neither doublings nor per-call precomputation, only bucket additions.
+             */
+            template<typename GroupValueType>
+            struct fixed_base_multiexp_table {
+                typedef GroupValueType value_type;
+
+                std::size_t window_size;
+                std::size_t windows_count;
+                std::vector<value_type> points;
+
+                fixed_base_multiexp_table() : window_size(0), windows_count(0) {
+                }
+
+                fixed_base_multiexp_table(std::size_t window_size, std::size_t windows_count,
+                                          std::vector<value_type> points) :
+                    window_size(window_size),
+                    windows_count(windows_count), points(std::move(points)) {
+                }
+
+                std::size_t bases_count() const {
+                    return windows_count == 0 ? 0 : points.size() / windows_count;
+                }
+
+                bool operator==(const fixed_base_multiexp_table &other) const {
+                    return window_size == other.window_size && windows_count == other.windows_count &&
+                           points == other.points;
+                }
+
+                bool operator!=(const fixed_base_multiexp_table &other) const {
+                    return !(*this == other);
+                }
+            };
+
+            constexpr std::size_t fixed_base_multiexp_max_window_size = 16;
+
+            /**
+             * Builds the fixed-base table for the bases and scalars of at most scalar_bits bits.
+             * The window size starts from the one multiexp_method_pippenger would use and grows until the table
+             * fits into memory_budget bytes; memory_budget == 0 means no limit. The window size never exceeds
+             * fixed_base_multiexp_max_window_size, so too small budgets are exceeded rather than making the
+             * buckets huge.
+             */
+            template<typename InputBaseIterator>
+            fixed_base_multiexp_table<typename std::iterator_traits<InputBaseIterator>::value_type>
+                make_fixed_base_multiexp_table(InputBaseIterator bases, InputBaseIterator bases_end,
+                                               const std::size_t scalar_bits, const std::size_t memory_budget = 0) {
+
+                typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+
+                const std::size_t length = std::distance(bases, bases_end);
+
+                std::size_t window_size = policies::multiexp_method_pippenger::window_size(length);
+                // one extra bit for the carry of the signed-digit recoding
+                while (memory_budget != 0 && window_size < fixed_base_multiexp_max_window_size &&
+                       length * (scalar_bits / window_size + 1) * sizeof(base_value_type) > memory_budget) {
+                    ++window_size;
+                }
+                const std::size_t windows_count = scalar_bits / window_size + 1;
+
+                std::vector<base_value_type> points(length * windows_count);
+
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                for (std::size_t i = 0; i < length; ++i) {
+                    base_value_type power = bases[i];
+                    for (std::size_t j = 0; j < windows_count; ++j) {
+                        points[i * windows_count + j] = power;
+                        if (j + 1 < windows_count) {
+                            for (std::size_t k = 0; k < window_size; ++k) {
+                                power.double_inplace();
+                            }
+                        }
+                    }
+                }
+
+                return fixed_base_multiexp_table<base_value_type>(window_size, windows_count, std::move(points));
+            }
+
+            /**
+             * Computes sum_i scalars[i] * bases[i] for the bases of the table.
+             * There may be fewer scalars than bases, then the first bases are used.
+             */
+            template<typename GroupValueType, typename InputFieldIterator>
+            GroupValueType fixed_base_multiexp(const fixed_base_multiexp_table<GroupValueType> &table,
+                                               InputFieldIterator scalars, InputFieldIterator scalars_end) {
+
+                typedef typename std::iterator_traits<InputFieldIterator>::value_type field_value_type;
+
+                const std::size_t length = std::distance(scalars, scalars_end);
+                BOOST_ASSERT(length <= table.bases_count());
+
+                if (length == 0) {
+                    return GroupValueType::zero();
+                }
+
+                const std::size_t c = table.window_size;
+                const std::size_t half_window = std::size_t(1) << (c - 1);
+                const std::size_t windows_count = table.windows_count;
+                const std::size_t num_bits = windows_count * c;
+
+#ifdef MULTICORE
+                const std::size_t chunks_count = std::min<std::size_t>(omp_get_max_threads(), length);
+#else
+                const std::size_t chunks_count = 1;
+#endif
+                std::vector<GroupValueType> partial_results(chunks_count, GroupValueType::zero());
+
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                for (std::size_t chunk = 0; chunk < chunks_count; ++chunk) {
+                    std::vector<GroupValueType> buckets(half_window, GroupValueType::zero());
+
+                    const std::size_t begin = chunk * length / chunks_count;
+                    const std::size_t end = (chunk + 1) * length / chunks_count;
+                    for (std::size_t i = begin; i < end; ++i) {
+                        const field_value_type &scalar = scalars[i];
+                        if (scalar == field_value_type::zero()) {
+                            continue;
+                        }
+                        const GroupValueType *multiples = table.points.data() + i * windows_count;
+
+                        std::size_t carry = 0;
+                        for (std::size_t w = 0; w < windows_count; ++w) {
+                            std::size_t window = carry;
+                            for (std::size_t j = 0; j < c && w * c + j < num_bits; ++j) {
+                                if (boost::multiprecision::bit_test(scalar.data, w * c + j)) {
+                                    window += std::size_t(1) << j;
+                                }
+                            }
+                            if (window > half_window) {
+                                // the digit is window - 2^c, which is zero for window == 2^c
+                                if (window != (half_window << 1)) {
+                                    buckets[(half_window << 1) - window - 1] += -multiples[w];
+                                }
+                                carry = 1;
+                            } else {
+                                if (window != 0) {
+                                    buckets[window - 1] += multiples[w];
+                                }
+                                carry = 0;
+                            }
+                        }
+                        BOOST_ASSERT(carry == 0);
+                    }
+
+                    GroupValueType running_sum = GroupValueType::zero();
+                    for (std::size_t d = half_window; d > 0; --d) {
+                        running_sum += buckets[d - 1];
+                        partial_results[chunk] += running_sum;
+                    }
+                }
+
+                GroupValueType result = GroupValueType::zero();
+                for (std::size_t chunk = 0; chunk < chunks_count; ++chunk) {
+                    result += partial_results[chunk];
+                }
+                return result;
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIXED_BASE_MULTIEXP_HPP
@@ -27,13 +27,21 @@
 #ifndef CRYPTO3_ALGEBRA_MULTIEXP_HPP
 #define CRYPTO3_ALGEBRA_MULTIEXP_HPP
 
+#include <algorithm>
+#include <limits>
+#include <type_traits>
 #include <vector>
 
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
 #include <boost/multiprecision/number.hpp>
 #include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
 
 #include <nil/crypto3/algebra/multiexp/policies.hpp>
 #include <nil/crypto3/algebra/curves/params.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -54,15 +62,23 @@ namespace nil {
 
                 const std::size_t one_chunk_size = total_size / chunks_count;
 
-                base_value_type result = base_value_type::zero();
+                std::vector<base_value_type> partial_results(chunks_count);
+
+                // Methods which are parallel themselves get the whole machine for every chunk
+#ifdef MULTICORE
+#pragma omp parallel for if (!policies::detail::is_parallel_multiexp_method<MultiexpMethod>::value)
+#endif
+                for (std::size_t i = 0; i < chunks_count; ++i) {
+                    partial_results[i] = MultiexpMethod::process(
+                            vec_start + i * one_chunk_size,
+                            (i == chunks_count - 1 ? vec_end : vec_start + (i + 1) * one_chunk_size),
+                            scalar_start + i * one_chunk_size,
+                            (i == chunks_count - 1 ? scalar_end : scalar_start + (i + 1) * one_chunk_size));
+                }
 
+                base_value_type result = base_value_type::zero();
                 for (std::size_t i = 0; i < chunks_count; ++i) {
-                    result =
-                            result + MultiexpMethod::process(
-                                    vec_start + i * one_chunk_size,
-                                    (i == chunks_count - 1 ? vec_end : vec_start + (i + 1) * one_chunk_size),
-                                    scalar_start + i * one_chunk_size,
-                                    (i == chunks_count - 1 ? scalar_end : scalar_start + (i + 1) * one_chunk_size));
+                    result = result + partial_results[i];
                 }
 
                 return result;
@@ -152,18 +168,24 @@ namespace nil {
                 window_table<GroupType> powers_of_g(
                         outerc, std::vector<typename GroupType::value_type>(in_window, GroupType::value_type::zero()));
 
-                typename GroupType::value_type gouter = g;
+                // gouter[outer] = 2^(outer * window) * g, the rows are then filled independently
+                std::vector<typename GroupType::value_type> gouter(outerc, g);
+                for (std::size_t outer = 1; outer < outerc; ++outer) {
+                    gouter[outer] = gouter[outer - 1];
+                    for (std::size_t i = 0; i < window; ++i) {
+                        gouter[outer].double_inplace();
+                    }
+                }
 
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
                 for (std::size_t outer = 0; outer < outerc; ++outer) {
                     typename GroupType::value_type ginner = GroupType::value_type::zero();
                     std::size_t cur_in_window = outer == outerc - 1 ? last_in_window : in_window;
                     for (std::size_t inner = 0; inner < cur_in_window; ++inner) {
                         powers_of_g[outer][inner] = ginner;
-                        ginner += gouter;
-                    }
-
-                    for (std::size_t i = 0; i < window; ++i) {
-                        gouter.double_inplace();
+                        ginner += gouter[outer];
                     }
                 }
 
@@ -207,6 +229,9 @@ namespace nil {
                                                                   const InputRange &v) {
                 std::vector<typename GroupType::value_type> res(std::distance(v.begin(), v.end()), table[0][0]);
 
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
                 for (std::size_t i = 0; i < v.size(); ++i) {
                     res[i] = windowed_exp<GroupType, FieldType>(scalar_size, window, table, v[i]);
                 }
@@ -225,6 +250,9 @@ namespace nil {
                                  const InputRange &v) {
                 std::vector<typename GroupType::value_type> res(std::distance(v.begin(), v.end()), table[0][0]);
 
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
                 for (std::size_t i = 0; i < v.size(); ++i) {
                     res[i] = windowed_exp<GroupType, FieldType>(scalar_size, window, table, coeff * v[i]);
                 }
@@ -257,6 +285,172 @@ namespace nil {
                     }
                 }
             }
+
+            namespace detail {
+                // Below this many elements per thread splitting the work costs more than it saves.
+                constexpr static const std::size_t batch_exp_min_chunk_size = 1024;
+
+#ifdef LOWMEM
+                constexpr static const std::size_t fixed_base_exp_max_window_size = 14;
+#else
+                constexpr static const std::size_t fixed_base_exp_max_window_size = 16;
+#endif
+
+                inline std::size_t batch_exp_chunks(std::size_t n) {
+#ifdef MULTICORE
+                    const std::size_t threads = omp_get_max_threads();    // to override, set OMP_NUM_THREADS env var
+                                                                          // or call omp_set_num_threads()
+#else
+                    const std::size_t threads = 1;
+#endif
+                    return std::max<std::size_t>(1, std::min(threads, n / batch_exp_min_chunk_size));
+                }
+
+                /**
+                 * Window minimizing the additions of building the table and of count windowed exponentiations,
+                 * ceil(scalar_size / w) * (2^w + count). Unlike get_exp_window_size it does not need
+                 * multiexp_params of the group.
+                 */
+                inline std::size_t fixed_base_exp_window_size(std::size_t scalar_size, std::size_t count) {
+                    std::size_t window = 1;
+                    std::size_t min_cost = std::numeric_limits<std::size_t>::max();
+                    for (std::size_t w = 1; w <= fixed_base_exp_max_window_size; ++w) {
+                        const std::size_t cost = (scalar_size + w - 1) / w * ((std::size_t(1) << w) + count);
+                        if (cost < min_cost) {
+                            window = w;
+                            min_cost = cost;
+                        }
+                    }
+                    return window;
+                }
+
+                // x = X / Z^2, y = Y / Z^3
+                template<typename Coordinates>
+                struct is_jacobian_coordinates
+                    : std::integral_constant<
+                          bool,
+                          std::is_same<Coordinates, curves::coordinates::jacobian>::value ||
+                              std::is_same<Coordinates, curves::coordinates::jacobian_with_a4_0>::value ||
+                              std::is_same<Coordinates, curves::coordinates::jacobian_with_a4_minus_3>::value> { };
+
+                // x = X / Z, y = Y / Z
+                template<typename Coordinates>
+                struct is_projective_coordinates
+                    : std::integral_constant<
+                          bool,
+                          std::is_same<Coordinates, curves::coordinates::projective>::value ||
+                              std::is_same<Coordinates, curves::coordinates::projective_with_a4_minus_1>::value ||
+                              std::is_same<Coordinates, curves::coordinates::projective_with_a4_minus_3>::value> { };
+            }    // namespace detail
+
+            /**
+             * Brings the points of vec to Z = 1 in place, so that they are converted to affine coordinates
+             * without an inversion each and may be used in mixed additions.
+             *
+             * The range is split into one chunk per thread and the Z coordinates of a chunk are inverted with a
+             * single field inversion (Montgomery's trick). Points in coordinates of other forms are left as they
+             * are.
+             */
+            template<typename GroupType, typename InputRange>
+            typename std::enable_if<
+                    std::is_same<typename InputRange::value_type, typename GroupType::value_type>::value, void>::type
+            batch_normalize(InputRange &vec) {
+                typedef typename GroupType::value_type group_value_type;
+                typedef typename group_value_type::coordinates coordinates_type;
+
+                if constexpr (detail::is_jacobian_coordinates<coordinates_type>::value ||
+                              detail::is_projective_coordinates<coordinates_type>::value) {
+                    typedef typename group_value_type::field_value_type field_value_type;
+
+                    const std::size_t n = vec.size();
+                    const std::size_t chunks = detail::batch_exp_chunks(n);
+
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static, 1)
+#endif
+                    for (std::size_t c = 0; c < chunks; ++c) {
+                        const std::size_t begin = n * c / chunks, end = n * (c + 1) / chunks;
+
+                        // prefix[i - begin] is the product of the Z coordinates of the non-zero points before i
+                        std::vector<field_value_type> prefix(end - begin);
+                        field_value_type acc = field_value_type::one();
+                        for (std::size_t i = begin; i < end; ++i) {
+                            prefix[i - begin] = acc;
+                            if (!vec[i].is_zero()) {
+                                acc *= vec[i].Z;
+                            }
+                        }
+
+                        field_value_type acc_inversed = acc.inversed();
+                        for (std::size_t i = end; i-- > begin;) {
+                            if (vec[i].is_zero()) {
+                                continue;
+                            }
+                            const field_value_type Z_inversed = acc_inversed * prefix[i - begin];
+                            acc_inversed *= vec[i].Z;
+
+                            if constexpr (detail::is_jacobian_coordinates<coordinates_type>::value) {
+                                const field_value_type Z_inversed_squared = Z_inversed.squared();
+                                vec[i].X *= Z_inversed_squared;
+                                vec[i].Y *= Z_inversed_squared * Z_inversed;
+                            } else {
+                                vec[i].X *= Z_inversed;
+                                vec[i].Y *= Z_inversed;
+                            }
+                            vec[i].Z = field_value_type::one();
+                        }
+                    }
+                }
+            }
+
+            /**
+             * @return coeff * x^i for i < count, each thread starting its chunk from coeff * x^begin
+             */
+            template<typename FieldValueType>
+            std::vector<FieldValueType> batch_powers(const FieldValueType &x, const std::size_t count,
+                                                     const FieldValueType &coeff = FieldValueType::one()) {
+                std::vector<FieldValueType> res(count);
+                const std::size_t chunks = detail::batch_exp_chunks(count);
+
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static, 1)
+#endif
+                for (std::size_t c = 0; c < chunks; ++c) {
+                    const std::size_t begin = count * c / chunks, end = count * (c + 1) / chunks;
+                    FieldValueType acc = coeff * x.pow(begin);
+                    for (std::size_t i = begin; i < end; ++i) {
+                        res[i] = acc;
+                        acc *= x;
+                    }
+                }
+
+                return res;
+            }
+
+            /**
+             * Computes coeff * tau^i * g for i < count, as in the structured reference strings of KZG, powers
+             * of tau and Groth16.
+             *
+             * Rather than a serial chain of count scalar multiplications, the powers of tau are computed in the
+             * scalar field, then multiplied by g in parallel with a fixed-base window table and normalized
+             * together.
+             */
+            template<typename GroupType, typename FieldType>
+            std::vector<typename GroupType::value_type>
+            batch_exp_powers(const typename GroupType::value_type &g,
+                             const typename FieldType::value_type &tau,
+                             const std::size_t count,
+                             const typename FieldType::value_type &coeff = FieldType::value_type::one()) {
+                const std::size_t scalar_size = FieldType::value_bits;
+                const std::size_t window = detail::fixed_base_exp_window_size(scalar_size, count);
+                const window_table<GroupType> table = get_window_table<GroupType>(scalar_size, window, g);
+
+                std::vector<typename GroupType::value_type> res =
+                        batch_exp<GroupType, FieldType>(scalar_size, window, table, batch_powers(tau, count, coeff));
+                batch_normalize<GroupType>(res);
+
+                return res;
+            }
         }    // namespace algebra
     }        // namespace crypto3
 }    // namespace nil
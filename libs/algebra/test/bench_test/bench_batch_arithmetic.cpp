@@ -0,0 +1,110 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// Batched field arithmetic against the element-by-element loops.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE algebra_batch_arithmetic_bench_test
+
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/batch_arithmetic.hpp>
+#include <nil/crypto3/algebra/fields/bls12/scalar_field.hpp>
+#include <nil/crypto3/algebra/fields/goldilocks64/base_field.hpp>
+#include <nil/crypto3/algebra/fields/pallas/base_field.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+using namespace nil::crypto3::algebra;
+
+BOOST_AUTO_TEST_SUITE(batch_arithmetic_manual_tests)
+
+// Average time per element in nanoseconds.
+double measure(std::size_t size, const std::function<void()> &operation) {
+    const std::size_t ROUNDS = 20;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (std::size_t r = 0; r < ROUNDS; ++r) {
+        operation();
+    }
+    auto finish = std::chrono::high_resolution_clock::now();
+
+    return std::chrono::duration<double, std::nano>(finish - start).count() / (ROUNDS * size);
+}
+
+template<typename FieldType>
+void run_perf_test(const std::string &field_name, std::size_t size) {
+    using value_type = typename FieldType::value_type;
+    using batch_arithmetic = fields::batch_arithmetic<value_type>;
+
+    std::vector<value_type> a(size), b(size), result(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        a[i] = random_element<FieldType>();
+        b[i] = random_element<FieldType>();
+    }
+
+    auto report = [](const std::string &name, double scalar, double batch) {
+        std::cout << name << ": scalar " << std::fixed << std::setprecision(3) << scalar << " ns, batch " << batch
+                  << " ns, speedup " << scalar / batch << std::endl;
+    };
+
+    std::cout << field_name << ", size " << size << std::endl;
+
+    report("Addition",
+           measure(size, [&]() { for (std::size_t i = 0; i < size; ++i) result[i] = a[i] + b[i]; }),
+           measure(size, [&]() { batch_arithmetic::add(result.data(), a.data(), b.data(), size); }));
+    report("Multiplication",
+           measure(size, [&]() { for (std::size_t i = 0; i < size; ++i) result[i] = a[i] * b[i]; }),
+           measure(size, [&]() { batch_arithmetic::mul(result.data(), a.data(), b.data(), size); }));
+    report("Scalar multiplication",
+           measure(size, [&]() { for (std::size_t i = 0; i < size; ++i) result[i] = a[i] * b[0]; }),
+           measure(size, [&]() { batch_arithmetic::mul(result.data(), a.data(), b[0], size); }));
+    report("Butterfly",
+           measure(size, [&]() {
+               for (std::size_t i = 0; i < size; ++i) {
+                   const value_type t = b[i] * result[i];
+                   result[i] = a[i] - t;
+                   a[i] += t;
+               }
+           }),
+           measure(size, [&]() { batch_arithmetic::butterfly(a.data(), result.data(), b.data(), size); }));
+
+    // prevent 'result' from being optimized out
+    std::cerr << result[size / 2] << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(batch_arithmetic_perf_test) {
+    for (std::size_t size : {1 << 10, 1 << 16}) {
+        run_perf_test<fields::goldilocks64_base_field>("Goldilocks64", size);
+        run_perf_test<fields::pallas_base_field>("Pallas base", size);
+        run_perf_test<fields::bls12_fr<381>>("BLS12-381 scalar", size);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
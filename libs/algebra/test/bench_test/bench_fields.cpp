@@ -52,6 +52,7 @@
 #include <nil/crypto3/algebra/fields/secp/secp_r1/base_field.hpp>
 #include <nil/crypto3/algebra/fields/secp/secp_r1/scalar_field.hpp>
 #include <nil/crypto3/algebra/fields/curve25519/base_field.hpp>
+#include <nil/crypto3/algebra/fields/goldilocks64/base_field.hpp>
 #include <nil/crypto3/algebra/random_element.hpp>
 
 using namespace nil::crypto3::algebra;
@@ -180,6 +181,10 @@ BOOST_AUTO_TEST_CASE(field_operation_perf_test_pallas) {
     run_perf_test<nil::crypto3::algebra::fields::pallas_base_field>("pallas");
 }
 
+BOOST_AUTO_TEST_CASE(field_operation_perf_test_goldilocks64) {
+    run_perf_test<nil::crypto3::algebra::fields::goldilocks64_base_field>("goldilocks64");
+}
+
 BOOST_AUTO_TEST_CASE(field_operation_perf_test_mnt) {
     run_perf_test<nil::crypto3::algebra::fields::mnt4_base_field<298>>("mnt4_298");
     run_perf_test<nil::crypto3::algebra::fields::mnt6_base_field<298>>("mnt6_298");
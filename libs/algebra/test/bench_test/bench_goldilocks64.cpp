@@ -0,0 +1,101 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// Element-wise Goldilocks array operations, the scalar element loop against the vector kernels.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE algebra_goldilocks64_bench_test
+
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/goldilocks64/base_field.hpp>
+#include <nil/crypto3/algebra/fields/goldilocks64/vector_arithmetic.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+using namespace nil::crypto3::algebra;
+
+BOOST_AUTO_TEST_SUITE(goldilocks64_manual_tests)
+
+using field_type = fields::goldilocks64_base_field;
+using value_type = typename field_type::value_type;
+using vector_arithmetic = fields::goldilocks64_vector_arithmetic;
+
+// Average time per element in nanoseconds.
+double measure(std::size_t size, const std::function<void()> &operation) {
+    const std::size_t ROUNDS = 100;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (std::size_t r = 0; r < ROUNDS; ++r) {
+        operation();
+    }
+    auto finish = std::chrono::high_resolution_clock::now();
+
+    return std::chrono::duration<double, std::nano>(finish - start).count() / (ROUNDS * size);
+}
+
+void run_perf_test(std::size_t size) {
+    std::vector<value_type> a(size), b(size), result(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        a[i] = random_element<field_type>();
+        b[i] = random_element<field_type>();
+    }
+
+    auto report = [](const std::string &name, double scalar, double vector) {
+        std::cout << name << ": scalar " << std::fixed << std::setprecision(3) << scalar << " ns, vector " << vector
+                  << " ns, speedup " << scalar / vector << std::endl;
+    };
+
+    std::cout << "Size " << size << std::endl;
+
+    report("Addition",
+           measure(size, [&]() { for (std::size_t i = 0; i < size; ++i) result[i] = a[i] + b[i]; }),
+           measure(size, [&]() { vector_arithmetic::add(result.data(), a.data(), b.data(), size); }));
+    report("Subtraction",
+           measure(size, [&]() { for (std::size_t i = 0; i < size; ++i) result[i] = a[i] - b[i]; }),
+           measure(size, [&]() { vector_arithmetic::sub(result.data(), a.data(), b.data(), size); }));
+    report("Multiplication",
+           measure(size, [&]() { for (std::size_t i = 0; i < size; ++i) result[i] = a[i] * b[i]; }),
+           measure(size, [&]() { vector_arithmetic::mul(result.data(), a.data(), b.data(), size); }));
+    report("Scalar multiplication",
+           measure(size, [&]() { for (std::size_t i = 0; i < size; ++i) result[i] = a[i] * b[0]; }),
+           measure(size, [&]() { vector_arithmetic::mul(result.data(), a.data(), b[0], size); }));
+
+    // prevent 'result' from being optimized out
+    std::cerr << result[size / 2] << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(vector_operation_perf_test_goldilocks64) {
+    // Fits into L1, into L2 and spills out of the caches.
+    run_perf_test(1 << 10);
+    run_perf_test(1 << 14);
+    run_perf_test(1 << 20);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
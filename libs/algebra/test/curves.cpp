@@ -53,6 +53,8 @@
 #include <nil/crypto3/algebra/curves/pallas.hpp>
 #include <nil/crypto3/algebra/fields/fp2.hpp>
 #include <nil/crypto3/algebra/fields/fp3.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/curves/detail/subgroup_check.hpp>
 
 #include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
 
@@ -406,6 +408,95 @@ void curve_operation_test_montgomery(const TestSet &test_set,
     check_montgomery_twisted_edwards_conversion(points, constants);
 }
 
+// A point of the curve outside the subgroup of prime order.
+template<typename CurveGroup>
+typename CurveGroup::value_type point_outside_subgroup() {
+    using value_type = typename CurveGroup::value_type;
+    using params_type = typename CurveGroup::params_type;
+    using field_value_type = typename CurveGroup::field_type::value_type;
+    using scalar_field_type = typename CurveGroup::curve_type::scalar_field_type;
+
+    value_type outside;
+    field_value_type x = field_value_type::one();
+    do {
+        x += field_value_type::one();
+        const field_value_type y2 = x.pow(3u) + field_value_type(params_type::b);
+        if (y2.is_square()) {
+            outside = value_type(x, y2.sqrt(), field_value_type::one());
+        }
+    } while (!outside.is_well_formed() || outside.is_zero() || (outside * scalar_field_type::modulus).is_zero());
+    return outside;
+}
+
+template<typename CurveGroup>
+void check_glv_scalar_mul() {
+    using params_type = typename CurveGroup::params_type;
+    using scalar_field_type = typename CurveGroup::curve_type::scalar_field_type;
+    using scalar_type = typename scalar_field_type::value_type;
+    using integral_type = typename scalar_field_type::integral_type;
+
+    static_assert(curves::detail::has_glv_endomorphism<typename CurveGroup::value_type>::value);
+
+    const typename CurveGroup::value_type P = random_element<CurveGroup>();
+
+    BOOST_CHECK(curves::detail::glv_endomorphism(P) == P * params_type::glv_lambda);
+
+    std::vector<scalar_type> scalars = {scalar_type::zero(),
+                                        scalar_type::one(),
+                                        -scalar_type::one(),
+                                        scalar_type(params_type::glv_lambda),
+                                        -scalar_type(params_type::glv_lambda)};
+    for (std::size_t i = 0; i < 32; ++i) {
+        scalars.push_back(random_element<scalar_field_type>());
+    }
+    for (const scalar_type &k : scalars) {
+        // multiplication by an integer does not use the endomorphism
+        const typename CurveGroup::value_type expected = P * static_cast<integral_type>(k.data);
+        BOOST_CHECK(curves::detail::glv_mul(P, k) == expected);
+        BOOST_CHECK(P * k == expected);
+
+        typename CurveGroup::value_type Q = P;
+        Q *= k;
+        BOOST_CHECK(Q == expected);
+    }
+
+    if constexpr (!curves::detail::has_prime_order<typename CurveGroup::value_type>::value) {
+        // phi is not multiplication by lambda outside the subgroup, operator* must not use it there
+        const typename CurveGroup::value_type outside = point_outside_subgroup<CurveGroup>();
+        for (std::size_t i = 0; i < 8; ++i) {
+            const scalar_type k = random_element<scalar_field_type>();
+            BOOST_CHECK(outside * k == outside * static_cast<integral_type>(k.data));
+
+            typename CurveGroup::value_type Q = outside;
+            Q *= k;
+            BOOST_CHECK(Q == outside * static_cast<integral_type>(k.data));
+        }
+    }
+}
+
+template<typename CurveGroup>
+void check_subgroup_check() {
+    using value_type = typename CurveGroup::value_type;
+
+    std::vector<value_type> points;
+    for (std::size_t i = 0; i < 64; ++i) {
+        points.push_back(random_element<CurveGroup>());
+        BOOST_CHECK(curves::detail::subgroup_check(points.back()));
+    }
+    BOOST_CHECK(curves::detail::subgroup_check(value_type::zero()));
+    BOOST_CHECK(curves::detail::batch_subgroup_check(points.begin(), points.end()));
+
+    if constexpr (!curves::detail::has_prime_order<value_type>::value) {
+        const value_type outside = point_outside_subgroup<CurveGroup>();
+
+        BOOST_CHECK(!curves::detail::subgroup_check(outside));
+        BOOST_CHECK(!curves::detail::subgroup_check(outside + points[0]));
+
+        points[points.size() / 2] = outside + points[points.size() / 2];
+        BOOST_CHECK(!curves::detail::batch_subgroup_check(points.begin(), points.end()));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE(curves_manual_tests)
 /**/
 
@@ -604,4 +695,45 @@ BOOST_DATA_TEST_CASE(curve_operation_test_vesta, string_data("curve_operation_te
                                                       fp_curve_test_init<policy_type>);
 }
 
+
+BOOST_AUTO_TEST_CASE(glv_scalar_mul_secp256_k1_g1) {
+    check_glv_scalar_mul<curves::secp_k1<256>::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(glv_scalar_mul_alt_bn128_g1) {
+    check_glv_scalar_mul<curves::alt_bn128<254>::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(glv_scalar_mul_bls12_381_g1) {
+    check_glv_scalar_mul<curves::bls12<381>::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(glv_scalar_mul_bls12_381_g2) {
+    check_glv_scalar_mul<curves::bls12<381>::g2_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(glv_scalar_mul_pallas) {
+    check_glv_scalar_mul<curves::pallas::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(glv_scalar_mul_vesta) {
+    check_glv_scalar_mul<curves::vesta::g1_type<>>();
+}
+
+
+BOOST_AUTO_TEST_CASE(subgroup_check_alt_bn128) {
+    check_subgroup_check<curves::alt_bn128<254>::g1_type<>>();
+    check_subgroup_check<curves::alt_bn128<254>::g2_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(subgroup_check_bls12_381) {
+    check_subgroup_check<curves::bls12<381>::g1_type<>>();
+    check_subgroup_check<curves::bls12<381>::g2_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(subgroup_check_bls12_377) {
+    check_subgroup_check<curves::bls12<377>::g1_type<>>();
+    check_subgroup_check<curves::bls12<377>::g2_type<>>();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
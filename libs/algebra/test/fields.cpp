@@ -58,7 +58,9 @@
 #include <nil/crypto3/algebra/fields/curve25519/base_field.hpp>
 #include <nil/crypto3/algebra/fields/curve25519/scalar_field.hpp>
 #include <nil/crypto3/algebra/fields/goldilocks64/base_field.hpp>
+#include <nil/crypto3/algebra/fields/goldilocks64/vector_arithmetic.hpp>
 #include <nil/crypto3/algebra/fields/maxprime.hpp>
+#include <nil/crypto3/algebra/fields/batch_arithmetic.hpp>
 
 #include <nil/crypto3/algebra/fields/detail/element/fp.hpp>
 #include <nil/crypto3/algebra/fields/detail/element/fp2.hpp>
@@ -70,6 +72,7 @@
 #include <nil/crypto3/algebra/curves/vesta.hpp>
 #include <nil/crypto3/algebra/curves/secp_k1.hpp>
 #include <nil/crypto3/algebra/curves/secp_r1.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
 
 using namespace nil::crypto3::algebra;
 
@@ -645,4 +648,111 @@ BOOST_AUTO_TEST_CASE(field_not_square_test_secp_r1) {
 
 }
 
+BOOST_AUTO_TEST_CASE(field_vector_arithmetic_test_goldilocks64) {
+    using field_type = fields::goldilocks64_base_field;
+    using value_type = typename field_type::value_type;
+    using vector_arithmetic = fields::goldilocks64_vector_arithmetic;
+
+    // Odd size to exercise the scalar tails, the edge values exercise the carries and borrows.
+    const std::size_t size = 1027;
+    std::vector<value_type> a(size), b(size), result(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        a[i] = random_element<field_type>();
+        b[i] = random_element<field_type>();
+    }
+    a[0] = -value_type::one();
+    b[0] = -value_type::one();
+    a[1] = value_type::zero();
+    b[1] = -value_type::one();
+    a[2] = value_type(0xFFFFFFFFu);
+    b[2] = value_type(0xFFFFFFFFu);
+
+    vector_arithmetic::add(result.data(), a.data(), b.data(), size);
+    for (std::size_t i = 0; i < size; ++i) {
+        BOOST_CHECK_EQUAL(result[i], a[i] + b[i]);
+    }
+    vector_arithmetic::sub(result.data(), a.data(), b.data(), size);
+    for (std::size_t i = 0; i < size; ++i) {
+        BOOST_CHECK_EQUAL(result[i], a[i] - b[i]);
+    }
+    vector_arithmetic::mul(result.data(), a.data(), b.data(), size);
+    for (std::size_t i = 0; i < size; ++i) {
+        BOOST_CHECK_EQUAL(result[i], a[i] * b[i]);
+    }
+    vector_arithmetic::mul(result.data(), a.data(), b[3], size);
+    for (std::size_t i = 0; i < size; ++i) {
+        BOOST_CHECK_EQUAL(result[i], a[i] * b[3]);
+    }
+}
+
+template<typename FieldType>
+void field_batch_arithmetic_test() {
+    using value_type = typename FieldType::value_type;
+    using batch_arithmetic = fields::batch_arithmetic<value_type>;
+
+    // Odd size to exercise the scalar tails.
+    const std::size_t size = 1027;
+    std::vector<value_type> a(size), b(size), w(size), result(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        a[i] = random_element<FieldType>();
+        b[i] = random_element<FieldType>();
+        w[i] = random_element<FieldType>();
+    }
+    a[0] = -value_type::one();
+    b[0] = -value_type::one();
+    a[1] = value_type::zero();
+    b[1] = -value_type::one();
+
+    batch_arithmetic::add(result.data(), a.data(), b.data(), size);
+    for (std::size_t i = 0; i < size; ++i) {
+        BOOST_CHECK_EQUAL(result[i], a[i] + b[i]);
+    }
+    batch_arithmetic::sub(result.data(), a.data(), b.data(), size);
+    for (std::size_t i = 0; i < size; ++i) {
+        BOOST_CHECK_EQUAL(result[i], a[i] - b[i]);
+    }
+    batch_arithmetic::mul(result.data(), a.data(), b.data(), size);
+    for (std::size_t i = 0; i < size; ++i) {
+        BOOST_CHECK_EQUAL(result[i], a[i] * b[i]);
+    }
+    batch_arithmetic::mul(result.data(), a.data(), b[3], size);
+    for (std::size_t i = 0; i < size; ++i) {
+        BOOST_CHECK_EQUAL(result[i], a[i] * b[3]);
+    }
+    batch_arithmetic::square(result.data(), a.data(), size);
+    for (std::size_t i = 0; i < size; ++i) {
+        BOOST_CHECK_EQUAL(result[i], a[i].squared());
+    }
+
+    // In place, as polynomial_dfs uses it.
+    result = a;
+    batch_arithmetic::mul(result.data(), result.data(), b.data(), size);
+    for (std::size_t i = 0; i < size; ++i) {
+        BOOST_CHECK_EQUAL(result[i], a[i] * b[i]);
+    }
+
+    std::vector<value_type> x = a, y = b;
+    batch_arithmetic::butterfly(x.data(), y.data(), w.data(), size);
+    for (std::size_t i = 0; i < size; ++i) {
+        BOOST_CHECK_EQUAL(x[i], a[i] + w[i] * b[i]);
+        BOOST_CHECK_EQUAL(y[i], a[i] - w[i] * b[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(field_batch_arithmetic_test_goldilocks64) {
+    field_batch_arithmetic_test<fields::goldilocks64_base_field>();
+}
+
+BOOST_AUTO_TEST_CASE(field_batch_arithmetic_test_pallas) {
+    field_batch_arithmetic_test<fields::pallas_base_field>();
+}
+
+BOOST_AUTO_TEST_CASE(field_batch_arithmetic_test_bls12_381_fr) {
+    field_batch_arithmetic_test<fields::bls12_fr<381>>();
+}
+
+BOOST_AUTO_TEST_CASE(field_batch_arithmetic_test_bls12_381_fq) {
+    field_batch_arithmetic_test<fields::bls12_fq<381>>();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
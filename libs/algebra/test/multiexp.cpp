@@ -0,0 +1,122 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE algebra_multiexp_test
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/multiexp/fixed_base_multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+using namespace nil::crypto3::algebra;
+
+template<typename GroupType, typename FieldType>
+void generate_instance(std::size_t size, std::vector<typename GroupType::value_type> &bases,
+                       std::vector<typename FieldType::value_type> &scalars) {
+    bases.resize(size);
+    scalars.resize(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        bases[i] = random_element<GroupType>();
+        scalars[i] = random_element<FieldType>();
+    }
+    // zero and minus one scalars exercise the signed-digit carries
+    if (size > 2) {
+        scalars[1] = FieldType::value_type::zero();
+        scalars[2] = -FieldType::value_type::one();
+    }
+}
+
+template<typename GroupType, typename FieldType>
+void test_fixed_base_multiexp() {
+    for (std::size_t size : {1, 2, 3, 31, 32, 100, 1000}) {
+        std::vector<typename GroupType::value_type> bases;
+        std::vector<typename FieldType::value_type> scalars;
+        generate_instance<GroupType, FieldType>(size, bases, scalars);
+
+        auto expected = multiexp<policies::multiexp_method_naive_plain>(bases.begin(), bases.end(),
+                                                                        scalars.begin(), scalars.end(), 1);
+        auto table = make_fixed_base_multiexp_table(bases.begin(), bases.end(), FieldType::modulus_bits);
+        BOOST_CHECK(expected == fixed_base_multiexp(table, scalars.begin(), scalars.end()));
+
+        // a small memory budget makes the windows wider
+        auto small_table = make_fixed_base_multiexp_table(bases.begin(), bases.end(), FieldType::modulus_bits,
+                                                          size * sizeof(typename GroupType::value_type) * 32);
+        BOOST_CHECK(small_table.window_size >= table.window_size);
+        BOOST_CHECK(expected == fixed_base_multiexp(small_table, scalars.begin(), scalars.end()));
+
+        // fewer scalars than bases
+        auto prefix_expected = multiexp<policies::multiexp_method_naive_plain>(
+            bases.begin(), bases.begin() + size / 2, scalars.begin(), scalars.begin() + size / 2, 1);
+        BOOST_CHECK(prefix_expected == fixed_base_multiexp(table, scalars.begin(), scalars.begin() + size / 2));
+    }
+}
+
+template<typename GroupType, typename FieldType>
+void test_batch_exp_powers(std::initializer_list<std::size_t> sizes) {
+    typedef typename GroupType::value_type group_value_type;
+
+    const group_value_type g = random_element<GroupType>();
+    const typename FieldType::value_type tau = random_element<FieldType>();
+    const typename FieldType::value_type coeff = random_element<FieldType>();
+
+    for (std::size_t size : sizes) {
+        const std::vector<group_value_type> powers = batch_exp_powers<GroupType, FieldType>(g, tau, size, coeff);
+        BOOST_CHECK_EQUAL(powers.size(), size);
+
+        group_value_type expected = coeff * g;
+        for (std::size_t i = 0; i < size; ++i) {
+            BOOST_CHECK(powers[i] == expected);
+            BOOST_CHECK(powers[i].Z == group_value_type::field_value_type::one());
+            expected = tau * expected;
+        }
+    }
+
+    // the point at infinity is kept as it is
+    std::vector<group_value_type> points = {g + g, group_value_type::zero(), tau * g};
+    const std::vector<group_value_type> expected = points;
+    batch_normalize<GroupType>(points);
+    BOOST_CHECK(points == expected);
+    BOOST_CHECK(points[1].is_zero());
+}
+
+BOOST_AUTO_TEST_SUITE(multiexp_test_suite)
+
+BOOST_AUTO_TEST_CASE(fixed_base_multiexp_bls12_381_g1) {
+    test_fixed_base_multiexp<curves::bls12<381>::g1_type<>, curves::bls12<381>::scalar_field_type>();
+}
+
+BOOST_AUTO_TEST_CASE(batch_exp_powers_bls12_381_g1) {
+    test_batch_exp_powers<curves::bls12<381>::g1_type<>, curves::bls12<381>::scalar_field_type>({0, 1, 2, 31, 2100});
+}
+
+BOOST_AUTO_TEST_CASE(batch_exp_powers_bls12_381_g2) {
+    test_batch_exp_powers<curves::bls12<381>::g2_type<>, curves::bls12<381>::scalar_field_type>({1, 2, 31});
+}
+
+BOOST_AUTO_TEST_SUITE_END()
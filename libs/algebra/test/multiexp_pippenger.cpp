@@ -0,0 +1,80 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE algebra_multiexp_pippenger_test
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+using namespace nil::crypto3::algebra;
+
+template<typename GroupType, typename FieldType>
+void generate_instance(std::size_t size, std::vector<typename GroupType::value_type> &bases,
+                       std::vector<typename FieldType::value_type> &scalars) {
+    bases.resize(size);
+    scalars.resize(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        bases[i] = random_element<GroupType>();
+        scalars[i] = random_element<FieldType>();
+    }
+    // zero and minus one scalars exercise the signed-digit carries
+    if (size > 2) {
+        scalars[1] = FieldType::value_type::zero();
+        scalars[2] = -FieldType::value_type::one();
+    }
+}
+
+template<typename GroupType, typename FieldType>
+void test_pippenger() {
+    for (std::size_t size : {1, 2, 3, 31, 32, 100, 1000}) {
+        std::vector<typename GroupType::value_type> bases;
+        std::vector<typename FieldType::value_type> scalars;
+        generate_instance<GroupType, FieldType>(size, bases, scalars);
+
+        auto expected = multiexp<policies::multiexp_method_naive_plain>(bases.begin(), bases.end(),
+                                                                        scalars.begin(), scalars.end(), 1);
+        BOOST_CHECK(expected == multiexp<policies::multiexp_method_pippenger>(bases.begin(), bases.end(),
+                                                                              scalars.begin(), scalars.end(), 1));
+        BOOST_CHECK(expected == multiexp<policies::multiexp_method_pippenger>(bases.begin(), bases.end(),
+                                                                              scalars.begin(), scalars.end(), 4));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(multiexp_pippenger_test_suite)
+
+BOOST_AUTO_TEST_CASE(pippenger_bls12_381_g1) {
+    test_pippenger<curves::bls12<381>::g1_type<>, curves::bls12<381>::scalar_field_type>();
+}
+
+BOOST_AUTO_TEST_CASE(pippenger_bls12_381_g2) {
+    test_pippenger<curves::bls12<381>::g2_type<>, curves::bls12<381>::scalar_field_type>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -195,6 +195,23 @@ void check_pairing_operations(std::vector<Fr_value_type> const& Fr_elements,
                       double_miller_loop<CurveType>(G1_prec_elements[prec_A1], G2_prec_elements[prec_B1],
                                                    G1_prec_elements[prec_A2], G2_prec_elements[prec_B2]));
     std::cout << " * Miller loop tests finished." << std::endl << std::endl;
+
+    std::cout << " * Multi-Miller loop tests started..." << std::endl;
+    BOOST_CHECK_EQUAL(multi_miller_loop<CurveType>(
+                          std::vector<g1_precomp_value_type>{G1_prec_elements[prec_A1], G1_prec_elements[prec_A2]},
+                          std::vector<g2_precomp_value_type>{G2_prec_elements[prec_B1], G2_prec_elements[prec_B2]}),
+                      GT_elements[double_miller_loop_prec_A1_prec_B1_prec_A2_prec_B2]);
+    BOOST_CHECK_EQUAL(multi_pair_reduced<CurveType>({G1_elements[A1], G1_elements[A2]},
+                                                    {G2_elements[B1], G2_elements[B2]}),
+                      GT_elements[pair_reduceding_A1_B1_mul_pair_reduceding_A2_B2]);
+    // e(A1, B1) == e(VKx, VKy) * e(C1, VKz)
+    BOOST_CHECK_EQUAL(multi_pair_reduced<CurveType>({G1_elements[A1], -G1_elements[VKx], -G1_elements[C1]},
+                                                    {G2_elements[B1], G2_elements[VKy], G2_elements[VKz]}),
+                      GT_value_type::one());
+    BOOST_CHECK(multi_pair_reduced<CurveType>({G1_elements[A1], -G1_elements[VKx], -G1_elements[C2]},
+                                              {G2_elements[B1], G2_elements[VKy], G2_elements[VKz]}) !=
+                GT_value_type::one());
+    std::cout << " * Multi-Miller loop tests finished." << std::endl << std::endl;
 }
 
 template<typename ElementType>
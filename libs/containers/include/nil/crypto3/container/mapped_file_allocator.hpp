@@ -0,0 +1,275 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Declaration of an allocator placing the elements into a memory-mapped file.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_CONTAINERS_MAPPED_FILE_ALLOCATOR_HPP
+#define CRYPTO3_CONTAINERS_MAPPED_FILE_ALLOCATOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace nil {
+    namespace crypto3 {
+        namespace containers {
+            namespace detail {
+                // The locked file and its regions, shared by an allocator, its copies and rebinds.
+                struct mapped_file_state {
+                    explicit mapped_file_state(const std::string &path) :
+                        path(path), page_size(static_cast<std::size_t>(::sysconf(_SC_PAGESIZE))), end(0),
+                        head(0) {
+                        fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+                        if (fd < 0) {
+                            throw std::runtime_error("Unable to open the mapped file " + path);
+                        }
+                        struct stat file_stat;
+                        if (::fstat(fd, &file_stat) != 0) {
+                            ::close(fd);
+                            throw std::runtime_error("Unable to open the mapped file " + path);
+                        }
+                        initial_size = static_cast<std::size_t>(file_stat.st_size);
+                        // The lock belongs to this open file description, so it also excludes the other
+                        // allocators of the same process and is released when the descriptor is closed.
+                        if (::flock(fd, LOCK_EX | LOCK_NB) != 0) {
+                            ::close(fd);
+                            throw std::runtime_error("The mapped file " + path + " is used by another allocator");
+                        }
+                    }
+
+                    mapped_file_state(const mapped_file_state &) = delete;
+                    mapped_file_state &operator=(const mapped_file_state &) = delete;
+
+                    ~mapped_file_state() {
+                        ::close(fd);
+                    }
+
+                    std::size_t allocate(std::size_t length) {
+                        std::size_t offset = end;
+                        auto it = std::find_if(free_regions.begin(), free_regions.end(),
+                                               [length](const std::pair<const std::size_t, std::size_t> &region) {
+                                                   return region.second >= length;
+                                               });
+                        if (it != free_regions.end()) {
+                            offset = it->first;
+                            if (it->second > length) {
+                                free_regions.emplace(offset + length, it->second - length);
+                            }
+                            free_regions.erase(it);
+                        } else {
+                            if (std::max(end, initial_size) < offset + length &&
+                                ::ftruncate(fd, offset + length) != 0) {
+                                throw std::runtime_error("Unable to resize the mapped file " + path);
+                            }
+                            end = offset + length;
+                        }
+                        if (offset == 0) {
+                            head = length;
+                        }
+                        return offset;
+                    }
+
+                    void deallocate(std::size_t offset, std::size_t length) {
+                        // Only the region at the beginning of the file is mapped again by a reopening
+                        // allocator, the blocks of the others are given back to the file system.
+                        if (offset != 0) {
+#ifdef FALLOC_FL_PUNCH_HOLE
+                            ::fallocate(fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, offset, length);
+#endif
+                        }
+
+                        auto it = free_regions.emplace(offset, length).first;
+                        auto next = std::next(it);
+                        if (next != free_regions.end() && it->first + it->second == next->first) {
+                            it->second += next->second;
+                            free_regions.erase(next);
+                        }
+                        if (it != free_regions.begin()) {
+                            auto prev = std::prev(it);
+                            if (prev->first + prev->second == it->first) {
+                                prev->second += it->second;
+                                free_regions.erase(it);
+                                it = prev;
+                            }
+                        }
+
+                        // The contents of the head are kept as the region a reopening allocator maps. If the
+                        // truncation fails, the free tail stays in the file and is reused as any other region.
+                        const std::size_t new_end = it->first == 0 ? head : it->first;
+                        if (it->first + it->second == end && ::ftruncate(fd, std::max(new_end, initial_size)) == 0) {
+                            end = new_end;
+                            if (it->first == 0) {
+                                it->second = head;
+                            } else {
+                                free_regions.erase(it);
+                            }
+                        }
+                    }
+
+                    std::string path;
+                    std::size_t page_size;
+                    int fd;
+                    // The file is never truncated below the size it had when opened.
+                    std::size_t initial_size;
+                    // The end of the allocated part of the file and the length of its region at offset 0.
+                    std::size_t end;
+                    std::size_t head;
+                    // The page-aligned regions released by deallocation, merged with their free neighbours.
+                    std::map<std::size_t, std::size_t> free_regions;
+                    // The offsets of the mapped regions by their addresses.
+                    std::map<const void *, std::size_t> offsets;
+                    std::mutex mutex;
+                };
+            }    // namespace detail
+
+            /**
+             * Allocator which places the elements into a shared memory mapping of a file, so the containers
+             * using it may be larger than the available RAM and are persisted on disk.
+             *
+             * Every allocation gets its own page-aligned region of the file, so a reallocating container or
+             * a copy of a container never aliases other storage. Deallocated regions are reused by the later
+             * allocations, a free tail of the file is truncated and the blocks of the other free regions are
+             * released with hole punching where the file system supports it. The region at the beginning of
+             * the file keeps its contents after deallocation, and the file is never truncated below the size
+             * it had when opened.
+             *
+             * The first allocation of a newly constructed allocator maps the file from its beginning. Default
+             * construction of the elements does not touch the memory, so a container of trivial elements
+             * allocated once over an existing file (e.g. a std::vector resized to its final size) sees the
+             * elements written there before. An allocator holds an exclusive advisory lock on the file while
+             * it or any of its copies is alive, and constructing another allocator over the same path throws
+             * until then.
+             */
+            template<typename T>
+            class mapped_file_allocator {
+                static_assert(std::is_trivially_copyable<T>::value,
+                              "Only trivially copyable types may be stored in a mapped file.");
+
+                template<typename U>
+                friend class mapped_file_allocator;
+
+            public:
+                typedef T value_type;
+                typedef std::size_t size_type;
+                typedef std::ptrdiff_t difference_type;
+
+                typedef std::false_type propagate_on_container_copy_assignment;
+                typedef std::false_type propagate_on_container_move_assignment;
+                typedef std::false_type propagate_on_container_swap;
+                typedef std::false_type is_always_equal;
+
+                template<typename U>
+                struct rebind {
+                    typedef mapped_file_allocator<U> other;
+                };
+
+                explicit mapped_file_allocator(const std::string &path) :
+                    _state(std::make_shared<detail::mapped_file_state>(path)) {
+                }
+
+                template<typename U>
+                mapped_file_allocator(const mapped_file_allocator<U> &other) : _state(other._state) {
+                }
+
+                T *allocate(size_type n) {
+                    if (n == 0) {
+                        return nullptr;
+                    }
+
+                    std::lock_guard<std::mutex> lock(_state->mutex);
+                    const std::size_t length = region_length(n);
+                    const std::size_t offset = _state->allocate(length);
+
+                    void *data = ::mmap(nullptr, n * sizeof(T), PROT_READ | PROT_WRITE, MAP_SHARED, _state->fd,
+                                        offset);
+                    if (data == MAP_FAILED) {
+                        _state->deallocate(offset, length);
+                        throw std::bad_alloc();
+                    }
+                    _state->offsets.emplace(data, offset);
+                    return static_cast<T *>(data);
+                }
+
+                void deallocate(T *p, size_type n) noexcept {
+                    if (p == nullptr) {
+                        return;
+                    }
+
+                    std::lock_guard<std::mutex> lock(_state->mutex);
+                    ::munmap(p, n * sizeof(T));
+                    auto it = _state->offsets.find(p);
+                    _state->deallocate(it->second, region_length(n));
+                    _state->offsets.erase(it);
+                }
+
+                template<typename U>
+                void construct(U *p) {
+                    ::new (static_cast<void *>(p)) U;
+                }
+
+                template<typename U, typename... Args>
+                void construct(U *p, Args &&...args) {
+                    ::new (static_cast<void *>(p)) U(std::forward<Args>(args)...);
+                }
+
+                const std::string &path() const {
+                    return _state->path;
+                }
+
+                template<typename U>
+                bool operator==(const mapped_file_allocator<U> &other) const {
+                    return _state == other._state;
+                }
+
+                template<typename U>
+                bool operator!=(const mapped_file_allocator<U> &other) const {
+                    return !(*this == other);
+                }
+
+            private:
+                std::size_t region_length(size_type n) const {
+                    return (n * sizeof(T) + _state->page_size - 1) / _state->page_size * _state->page_size;
+                }
+
+                std::shared_ptr<detail::mapped_file_state> _state;
+            };
+        }    // namespace containers
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_CONTAINERS_MAPPED_FILE_ALLOCATOR_HPP
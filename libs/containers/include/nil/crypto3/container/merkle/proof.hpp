@@ -29,6 +29,7 @@
 #define CRYPTO3_MERKLE_PROOF_HPP
 
 #include <algorithm>
+#include <numeric>
 #include <vector>
 #include <stack>
 
@@ -100,30 +101,13 @@ namespace nil {
                     merkle_proof_impl(std::size_t li, value_type root, path_type path) : _li(li), _root(root),
                                                                                          _path(path){};
 
-                    merkle_proof_impl(const merkle_tree<hash_type, arity> &tree, const std::size_t leaf_idx) {
-                        _root = tree.root();
-                        _path.resize(tree.row_count() - 1);
-                        _li = leaf_idx;
-
-                        typename std::vector<layer_type>::iterator v_itr = _path.begin();
-                        std::size_t cur_leaf = leaf_idx;
-                        std::size_t row_len = tree.leaves();
-                        std::size_t row_begin_idx = 0;
-                        while (cur_leaf != tree.size() - 1) {    // while it's not _root
-                            std::size_t cur_leaf_pos = cur_leaf % arity;
-                            std::size_t cur_leaf_arity_pos = (cur_leaf - row_begin_idx) / arity;
-                            std::size_t begin_this_arity = cur_leaf - cur_leaf_pos;
-                            typename layer_type::iterator a_itr = v_itr->begin();
-                            for (size_t i = 0; i < cur_leaf_pos; ++i, ++begin_this_arity, ++a_itr) {
-                                *a_itr = path_element_type(tree[begin_this_arity], i);
-                            }
-                            for (size_t i = cur_leaf_pos + 1; i < arity; ++i, ++begin_this_arity, ++a_itr) {
-                                *a_itr = path_element_type(tree[begin_this_arity + 1], i);
-                            }
-                            v_itr++;
-                            cur_leaf = row_len + row_begin_idx + cur_leaf_arity_pos;
-                            row_begin_idx += row_len;
-                            row_len /= arity;
+                    template<typename Allocator>
+                    merkle_proof_impl(const merkle_tree_impl<merkle_tree_node<hash_type>, Arity, Allocator> &tree,
+                                      const std::size_t leaf_idx) :
+                            _li(leaf_idx), _root(tree.root()), _path(tree.row_count() - 1) {
+                        std::size_t position = leaf_idx;
+                        for (std::size_t row = 0; row < _path.size(); ++row, position /= arity) {
+                            _path[row] = make_layer(tree, row, position);
                         }
                     }
 
@@ -146,8 +130,48 @@ namespace nil {
                         return (d == _root);
                     }
 
+                    /**
+                     * Generates the full proofs for all the leaf_idxs at once. The leaves are walked up the
+                     * tree together in sorted order, so every row is read sequentially and the layers of the
+                     * paths which have already merged are copied instead of being read from the tree again.
+                     */
+                    template<typename Allocator>
+                    static std::vector<merkle_proof_impl>
+                        generate_proofs(const merkle_tree_impl<merkle_tree_node<hash_type>, Arity, Allocator> &tree,
+                                        const std::vector<std::size_t> &leaf_idxs) {
+                        std::vector<std::size_t> sorted_idx(leaf_idxs.size());
+                        std::iota(sorted_idx.begin(), sorted_idx.end(), 0);
+                        std::sort(sorted_idx.begin(), sorted_idx.end(), [&leaf_idxs](std::size_t i, std::size_t j) {
+                            return leaf_idxs[i] < leaf_idxs[j];
+                        });
+
+                        const value_type root = tree.root();
+                        std::vector<merkle_proof_impl> result_proofs(leaf_idxs.size());
+                        for (std::size_t i = 0; i < leaf_idxs.size(); ++i) {
+                            result_proofs[i] = merkle_proof_impl(leaf_idxs[i], root, path_type(tree.row_count() - 1));
+                        }
+
+                        // Positions of the leaves ancestors in the current row, they stay sorted up to the root.
+                        std::vector<std::size_t> positions(leaf_idxs);
+                        for (std::size_t row = 0; row + 1 < tree.row_count(); ++row) {
+                            for (std::size_t k = 0; k < sorted_idx.size(); ++k) {
+                                const std::size_t idx = sorted_idx[k];
+                                if (k > 0 && positions[idx] == positions[sorted_idx[k - 1]]) {
+                                    result_proofs[idx]._path[row] = result_proofs[sorted_idx[k - 1]]._path[row];
+                                } else {
+                                    result_proofs[idx]._path[row] = make_layer(tree, row, positions[idx]);
+                                }
+                            }
+                            for (std::size_t &position : positions) {
+                                position /= Arity;
+                            }
+                        }
+                        return result_proofs;
+                    }
+
+                    template<typename Allocator>
                     static std::vector<merkle_proof_impl>
-                        generate_compressed_proofs(const containers::merkle_tree<NodeType, Arity> &tree,
+                        generate_compressed_proofs(const merkle_tree_impl<NodeType, Arity, Allocator> &tree,
                                                     std::vector<std::size_t> leaf_idxs) {
                         assert(leaf_idxs.size() > 0);
                         std::vector<std::size_t> sorted_idx(leaf_idxs.size());
@@ -278,6 +302,22 @@ namespace nil {
                     }
 
                 private:
+                    // Siblings of the position-th node of the row.
+                    template<typename TreeType>
+                    static layer_type make_layer(const TreeType &tree, std::size_t row, std::size_t position) {
+                        const std::size_t position_in_group = position % Arity;
+                        const std::size_t group_begin = tree.node_index(row, position - position_in_group);
+
+                        layer_type layer;
+                        typename layer_type::iterator layer_itr = layer.begin();
+                        for (std::size_t i = 0; i < Arity; ++i) {
+                            if (i != position_in_group) {
+                                *layer_itr++ = path_element_type(tree[group_begin + i], i);
+                            }
+                        }
+                        return layer;
+                    }
+
                     std::size_t _li;
                     value_type _root;
                     path_type _path;
@@ -27,8 +27,14 @@
 #ifndef CRYPTO3_MERKLE_TREE_HPP
 #define CRYPTO3_MERKLE_TREE_HPP
 
-#include <vector>
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
 
 #include <nil/crypto3/algebra/curves/pallas.hpp>
 
@@ -37,6 +43,7 @@
 
 #include <nil/crypto3/hash/type_traits.hpp>
 #include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
 #include <nil/crypto3/container/merkle/node.hpp>
 
 namespace nil {
@@ -146,7 +153,10 @@ namespace nil {
 
                 // Merkle Tree.
                 //
-                // All _leaves and nodes are stored in a BGL graph structure.
+                // All _leaves and nodes are stored in a single flat container, row by row: first the _leaves,
+                // then their parents and so on, the root being the last element. The nodes of a row are
+                // adjacent, so both the construction and the proofs extraction access memory sequentially,
+                // and the position of every node is computed arithmetically, see row_offset.
                 //
                 // A merkle tree is a tree in which every non-leaf node is the hash of its
                 // child nodes. A diagram for merkle_tree_impl arity = 2:
@@ -158,16 +168,18 @@ namespace nil {
                 // h1 = h(tx1)  h2 = h(tx2)    h3 = h(tx3)  h4 = h(tx4)
                 // ```
                 //
-                // In graph representation:
+                // In memory:
                 //
                 // ```text
-                //    root -> h12, h34
-                //    h12  -> h1, h2
-                //    h34  -> h3, h4
+                //    h1, h2, h3, h4, h12, h34, h1234
                 // ```
                 //
                 // Merkle root is always the top element.
-                template<typename NodeType, size_t Arity = 2>
+                //
+                // The container allocator may be replaced, e.g. with mapped_file_allocator to keep the trees
+                // larger than RAM on disk.
+                template<typename NodeType, size_t Arity = 2,
+                         typename Allocator = std::allocator<typename NodeType::value_type>>
                 struct merkle_tree_impl {
                     typedef NodeType node_type;
 
@@ -176,7 +188,7 @@ namespace nil {
                     typedef typename node_type::value_type value_type;
                     constexpr static const std::size_t value_bits = node_type::value_bits;
 
-                    typedef std::vector<value_type> container_type;
+                    typedef std::vector<value_type, Allocator> container_type;
 
                     typedef typename container_type::allocator_type allocator_type;
                     typedef typename container_type::reference reference;
@@ -201,6 +213,13 @@ namespace nil {
                                          "Wrong leaves number, it must be a power of Arity.");
                     }
 
+                    merkle_tree_impl(size_t n, const allocator_type &a) :
+                            _hashes(a), _size(detail::merkle_tree_length(n, Arity)), _leaves(n),
+                            _rc(detail::merkle_tree_row_count(n, Arity)) {
+                        BOOST_ASSERT_MSG(pow(Arity, round(std::log(n) / std::log(Arity))) == n,
+                                         "Wrong leaves number, it must be a power of Arity.");
+                    }
+
                     merkle_tree_impl(const merkle_tree_impl &x) :
                             _hashes(x._hashes), _size(x._size), _leaves(x._leaves), _rc(x._rc) {
                     }
@@ -231,7 +250,7 @@ namespace nil {
 
                     merkle_tree_impl(merkle_tree_impl &&x)
                     BOOST_NOEXCEPT(std::is_nothrow_move_constructible<allocator_type>::value):
-                            _hashes(x._hashes),
+                            _hashes(std::move(x._hashes)),
                             _size(x._size), _leaves(x._leaves), _rc(x._rc) {
                     }
 
@@ -245,7 +264,7 @@ namespace nil {
                     }
 
                     merkle_tree_impl &operator=(merkle_tree_impl &&x) {
-                        _hashes = x._hashes;
+                        _hashes = std::move(x._hashes);
                         _size = x._size;
                         _leaves = x._leaves;
                         _rc = x._rc;
@@ -442,6 +461,22 @@ namespace nil {
                         return _leaves;
                     }
 
+                    // Index of the first node of the row, the leaves being the row 0. The row r holds
+                    // _leaves / Arity^r nodes, so the rows below it hold
+                    // _leaves * (1 + 1/Arity + ... + 1/Arity^(r-1)) = (_leaves - _leaves / Arity^r) * Arity / (Arity - 1).
+                    size_t row_offset(size_t row) const {
+                        std::size_t row_size = _leaves;
+                        for (std::size_t i = 0; i < row; ++i) {
+                            row_size /= Arity;
+                        }
+                        return (_leaves - row_size) / (Arity - 1) * Arity;
+                    }
+
+                    // Index of the node_idx-th node of the row.
+                    size_t node_index(size_t row, size_t node_idx) const {
+                        return row_offset(row) + node_idx;
+                    }
+
                     void set_leaves(size_t s) {
                         _leaves = s;
                     }
@@ -478,34 +513,145 @@ namespace nil {
                     return accumulators::extract::hash<T>(acc);
                 }
 
-                template<typename T, std::size_t Arity, typename LeafIterator>
-                merkle_tree_impl<T, Arity> make_merkle_tree(LeafIterator first, LeafIterator last) {
-                    typedef T node_type;
-                    typedef typename node_type::hash_type hash_type;
+                // Rows with fewer nodes than this are hashed on a single thread.
+                constexpr std::size_t merkle_tree_parallel_min_row_size = 256;
+
+                /**
+                 * Hashes the parents of a tree row, every parent being the hash of Arity consecutive children.
+                 * Hashes which can compress several independent messages at once (e.g. multi-lane SIMD
+                 * implementations) may specialize this to process up to `lanes` parents per call. The parents
+                 * must be exactly the same as generate_hash gives for each of them.
+                 */
+                template<typename Hash, typename Enable = void>
+                struct merkle_node_batch_hasher {
+                    constexpr static const std::size_t lanes = 1;
+
+                    template<std::size_t Arity, typename InputIterator, typename OutputIterator>
+                    static void process(InputIterator children, std::size_t parents_count, OutputIterator parents) {
+                        for (std::size_t i = 0; i < parents_count; ++i, children += Arity) {
+                            parents[i] = generate_hash<Hash>(children, children + Arity);
+                        }
+                    }
+                };
 
-                    merkle_tree_impl<T, Arity> ret(std::distance(first, last));
-                    ret.reserve(ret.complete_size());
+#ifndef __ZKLLVM__
+                /**
+                 * SHA-256 parents all hash Arity * 32 bytes, so the compressor hashes 8 of them at once.
+                 */
+                template<>
+                struct merkle_node_batch_hasher<hashes::sha2<256>> {
+                    typedef hashes::sha2<256> hash_type;
+                    typedef typename hash_type::digest_type digest_type;
+                    typedef hashes::detail::sha256_compressor compressor_type;
+
+                    constexpr static const std::size_t lanes = compressor_type::lanes;
+
+                    template<std::size_t Arity, typename InputIterator, typename OutputIterator>
+                    static void process(InputIterator children, std::size_t parents_count, OutputIterator parents) {
+                        constexpr std::size_t digest_size = hash_type::digest_bits / 8;
+                        constexpr std::size_t message_size = Arity * digest_size;
+
+                        std::array<std::uint8_t, lanes * message_size> messages;
+                        std::array<std::uint8_t, lanes * digest_size> digests;
+                        for (std::size_t i = 0; i < parents_count * Arity; ++i) {
+                            const digest_type &child = children[i];
+                            std::copy(child.begin(), child.end(), messages.begin() + i * digest_size);
+                        }
+                        compressor_type::hash_many(messages.data(), message_size, parents_count, digests.data());
+                        for (std::size_t i = 0; i < parents_count; ++i) {
+                            digest_type parent;
+                            std::copy(digests.begin() + i * digest_size, digests.begin() + (i + 1) * digest_size,
+                                      parent.begin());
+                            parents[i] = parent;
+                        }
+                    }
+                };
+#endif
 
+                template<typename Hash, typename LeafIterator, typename OutputIterator>
+                void hash_merkle_tree_leaves(LeafIterator first, LeafIterator last, OutputIterator out,
+                                             std::input_iterator_tag) {
                     while (first != last) {
-                        ret.emplace_back(crypto3::hash<hash_type>(*first++));
+                        *out++ = crypto3::hash<Hash>(*first++);
                     }
+                }
 
-                    std::size_t row_idx = ret.leaves(), row_size = row_idx / Arity;
-                    typename merkle_tree_impl<T, Arity>::iterator it = ret.begin();
+                template<typename Hash, typename LeafIterator, typename OutputIterator>
+                void hash_merkle_tree_leaves(LeafIterator first, LeafIterator last, OutputIterator out,
+                                             std::random_access_iterator_tag) {
+                    const std::size_t leaves_count = std::distance(first, last);
+#ifdef MULTICORE
+#pragma omp parallel for if (leaves_count >= merkle_tree_parallel_min_row_size)
+#endif
+                    for (std::size_t i = 0; i < leaves_count; ++i) {
+                        out[i] = crypto3::hash<Hash>(first[i]);
+                    }
+                }
 
-                    for (size_t row_number = 1; row_number < ret.row_count(); ++row_number, row_size /= Arity) {
-                        for (size_t i = 0; i < row_size; ++i, it += Arity) {
-                            ret.emplace_back(generate_hash<hash_type>(it, it + Arity));
-                        }
+                template<typename Hash, std::size_t Arity, typename Iterator>
+                void hash_merkle_tree_row(Iterator children, std::size_t parents_count, Iterator parents) {
+                    constexpr std::size_t lanes = merkle_node_batch_hasher<Hash>::lanes;
+                    const std::size_t batches_count = (parents_count + lanes - 1) / lanes;
+#ifdef MULTICORE
+#pragma omp parallel for if (parents_count >= merkle_tree_parallel_min_row_size)
+#endif
+                    for (std::size_t batch = 0; batch < batches_count; ++batch) {
+                        const std::size_t first_parent = batch * lanes;
+                        merkle_node_batch_hasher<Hash>::template process<Arity>(
+                            children + first_parent * Arity, std::min(lanes, parents_count - first_parent),
+                            parents + first_parent);
                     }
+                }
+
+                template<typename T, std::size_t Arity, typename Allocator>
+                void hash_merkle_tree_rows(merkle_tree_impl<T, Arity, Allocator> &tree) {
+                    typedef typename T::hash_type hash_type;
+
+                    // Every row is hashed from the previous one, the nodes inside a row are independent.
+                    for (size_t row_number = 1; row_number < tree.row_count(); ++row_number) {
+                        const std::size_t row_begin = tree.row_offset(row_number - 1);
+                        const std::size_t row_size = tree.row_offset(row_number) - row_begin;
+                        hash_merkle_tree_row<hash_type, Arity>(tree.begin() + row_begin, row_size / Arity,
+                                                               tree.begin() + row_begin + row_size);
+                    }
+                }
+
+                template<typename T, std::size_t Arity, typename LeafIterator, typename Allocator>
+                merkle_tree_impl<T, Arity, Allocator> make_merkle_tree(LeafIterator first, LeafIterator last,
+                                                                       const Allocator &alloc) {
+                    typedef T node_type;
+                    typedef typename node_type::hash_type hash_type;
+
+                    merkle_tree_impl<T, Arity, Allocator> ret(std::distance(first, last), alloc);
+                    ret.resize(ret.complete_size());
+
+                    hash_merkle_tree_leaves<hash_type>(
+                        first, last, ret.begin(), typename std::iterator_traits<LeafIterator>::iterator_category());
+                    hash_merkle_tree_rows(ret);
+                    return ret;
+                }
+
+                template<typename T, std::size_t Arity, typename LeafIterator>
+                merkle_tree_impl<T, Arity> make_merkle_tree(LeafIterator first, LeafIterator last) {
+                    return make_merkle_tree<T, Arity>(first, last, std::allocator<typename T::value_type>());
+                }
+
+                template<typename T, std::size_t Arity, typename Allocator>
+                merkle_tree_impl<T, Arity, Allocator> open_merkle_tree(std::size_t leaves_count,
+                                                                       const Allocator &alloc) {
+                    static_assert(std::is_trivially_default_constructible<typename T::value_type>::value,
+                                  "Stored nodes must not be overwritten on the tree construction.");
+
+                    merkle_tree_impl<T, Arity, Allocator> ret(leaves_count, alloc);
+                    ret.resize(ret.complete_size());
                     return ret;
                 }
             }    // namespace detail
 
             template<typename T, std::size_t Arity>
-            using merkle_tree = typename std::conditional<nil::crypto3::detail::is_hash<T>::value,
-                    detail::merkle_tree_impl<detail::merkle_tree_node<T>, Arity>,
-                    detail::merkle_tree_impl<T, Arity>>::type;
+            using merkle_tree = detail::merkle_tree_impl<typename std::conditional<nil::crypto3::detail::is_hash<T>::value,
+                    detail::merkle_tree_node<T>,
+                    T>::type, Arity>;
 
             template<typename T, std::size_t Arity, typename LeafIterator>
             merkle_tree<T, Arity> make_merkle_tree(LeafIterator first, LeafIterator last) {
@@ -515,6 +661,36 @@ namespace nil {
                         Arity>(first, last);
             }
 
+            /**
+             * Builds the tree storing its nodes with the given allocator, e.g. mapped_file_allocator
+             * for the trees which do not fit into RAM.
+             */
+            template<typename T, std::size_t Arity, typename LeafIterator, typename Allocator>
+            detail::merkle_tree_impl<typename std::conditional<nil::crypto3::detail::is_hash<T>::value,
+                                                               detail::merkle_tree_node<T>, T>::type,
+                                     Arity, Allocator>
+                make_merkle_tree(LeafIterator first, LeafIterator last, const Allocator &alloc) {
+                return detail::make_merkle_tree<typename std::conditional<nil::crypto3::detail::is_hash<T>::value,
+                        detail::merkle_tree_node<T>,
+                        T>::type,
+                        Arity>(first, last, alloc);
+            }
+
+            /**
+             * Attaches to the nodes of a tree with leaves_count leaves which were previously stored by the
+             * allocator, e.g. a tree built with make_merkle_tree over the same mapped file.
+             */
+            template<typename T, std::size_t Arity, typename Allocator>
+            detail::merkle_tree_impl<typename std::conditional<nil::crypto3::detail::is_hash<T>::value,
+                                                               detail::merkle_tree_node<T>, T>::type,
+                                     Arity, Allocator>
+                open_merkle_tree(std::size_t leaves_count, const Allocator &alloc) {
+                return detail::open_merkle_tree<typename std::conditional<nil::crypto3::detail::is_hash<T>::value,
+                        detail::merkle_tree_node<T>,
+                        T>::type,
+                        Arity>(leaves_count, alloc);
+            }
+
         }    // namespace containers
     }        // namespace crypto3
 }    // namespace nil
@@ -38,6 +38,7 @@
 
 #include <nil/crypto3/container/merkle/tree.hpp>
 #include <nil/crypto3/container/merkle/proof.hpp>
+#include <nil/crypto3/container/mapped_file_allocator.hpp>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -45,6 +46,7 @@
 
 #include <chrono>
 #include <cstdio>
+#include <filesystem>
 #include <limits>
 #include <type_traits>
 #include <nil/crypto3/hash/algorithm/hash.hpp>
@@ -278,6 +280,139 @@ BOOST_AUTO_TEST_CASE(merkletree_construct_test_2) {
     BOOST_CHECK_EQUAL(tree.row_count(), 3);
 }
 
+BOOST_AUTO_TEST_CASE(merkletree_construct_large_rows_test) {
+    // Rows are large enough to be hashed in parallel, every node must match the node-by-node construction.
+    using hash_type = hashes::sha2<256>;
+    auto v = generate_random_data<std::uint8_t, 4>(1 << 12);
+    merkle_tree<hash_type, 2> tree = make_merkle_tree<hash_type, 2>(v.begin(), v.end());
+    BOOST_CHECK_EQUAL(tree.size(), (1 << 13) - 1);
+
+    std::vector<typename hash_type::digest_type> expected;
+    expected.reserve(tree.size());
+    for (const auto &leaf : v) {
+        expected.emplace_back(hash<hash_type>(leaf));
+    }
+    for (std::size_t i = 0; expected.size() < tree.size(); i += 2) {
+        expected.emplace_back(
+            containers::detail::generate_hash<hash_type>(expected.begin() + i, expected.begin() + i + 2));
+    }
+    BOOST_CHECK(std::equal(tree.begin(), tree.end(), expected.begin()));
+}
+
+BOOST_AUTO_TEST_CASE(merkletree_mapped_file_test) {
+    using hash_type = hashes::sha2<256>;
+    using allocator_type = mapped_file_allocator<typename hash_type::digest_type>;
+    const std::string path =
+        (std::filesystem::temp_directory_path() / "crypto3_merkletree_mapped_file_test.bin").string();
+    std::filesystem::remove(path);
+
+    auto v = generate_random_data<std::uint8_t, 4>(1 << 10);
+    merkle_tree<hash_type, 2> tree = make_merkle_tree<hash_type, 2>(v.begin(), v.end());
+    {
+        auto mapped_tree = make_merkle_tree<hash_type, 2>(v.begin(), v.end(), allocator_type(path));
+        BOOST_CHECK_EQUAL(mapped_tree.size(), tree.size());
+        BOOST_CHECK(std::equal(tree.begin(), tree.end(), mapped_tree.begin()));
+    }
+
+    // The nodes written by the previous tree are read back from the file.
+    auto opened_tree = open_merkle_tree<hash_type, 2>(v.size(), allocator_type(path));
+    BOOST_CHECK(std::equal(tree.begin(), tree.end(), opened_tree.begin()));
+    BOOST_CHECK(opened_tree.root() == tree.root());
+
+    std::vector<std::size_t> proof_idxs = {17, 3, 1000, 16, 3, 0, 1023};
+    auto proofs = merkle_proof<hash_type, 2>::generate_proofs(opened_tree, proof_idxs);
+    BOOST_CHECK_EQUAL(proofs.size(), proof_idxs.size());
+    for (std::size_t i = 0; i < proof_idxs.size(); ++i) {
+        BOOST_CHECK(proofs[i] == merkle_proof<hash_type, 2>(tree, proof_idxs[i]));
+        BOOST_CHECK(proofs[i].validate(v[proof_idxs[i]]));
+    }
+    std::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(mapped_file_allocator_no_aliasing_test) {
+    using allocator_type = mapped_file_allocator<std::uint32_t>;
+    const std::string path =
+        (std::filesystem::temp_directory_path() / "crypto3_mapped_file_allocator_test.bin").string();
+    std::filesystem::remove(path);
+    {
+        std::vector<std::uint32_t, allocator_type> grown {allocator_type(path)};
+        // Growth reallocates several times; every region must survive the move of the previous one.
+        for (std::uint32_t i = 0; i < (1 << 16); ++i) {
+            grown.push_back(i);
+        }
+        std::vector<std::uint32_t, allocator_type> copy = grown;
+        copy[5] = 0;
+        std::vector<std::uint32_t, allocator_type> assigned {grown.get_allocator()};
+        assigned.resize(16);
+        assigned = grown;
+        assigned[7] = 0;
+        for (std::uint32_t i = 0; i < (1 << 16); ++i) {
+            BOOST_CHECK_EQUAL(grown[i], i);
+        }
+        BOOST_CHECK_EQUAL(copy[5], 0);
+        BOOST_CHECK_EQUAL(assigned[7], 0);
+
+        // The file is locked while the allocator and its copies are alive.
+        BOOST_CHECK_THROW(allocator_type {path}, std::runtime_error);
+    }
+    // Only the first page at the beginning of the file is kept after all the regions are released.
+    BOOST_CHECK_EQUAL(std::filesystem::file_size(path), static_cast<std::uintmax_t>(::sysconf(_SC_PAGESIZE)));
+    std::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(mapped_file_allocator_reuse_test) {
+    using allocator_type = mapped_file_allocator<std::uint32_t>;
+    const std::string path =
+        (std::filesystem::temp_directory_path() / "crypto3_mapped_file_allocator_reuse_test.bin").string();
+    std::filesystem::remove(path);
+    {
+        allocator_type allocator(path);
+        const std::size_t page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        const std::size_t page_elements = page_size / sizeof(std::uint32_t);
+
+        std::uint32_t *head = allocator.allocate(page_elements);
+        std::uint32_t *middle = allocator.allocate(4 * page_elements);
+        std::uint32_t *tail = allocator.allocate(page_elements);
+        BOOST_CHECK_EQUAL(std::filesystem::file_size(path), 6 * page_size);
+
+        // A released region in the middle of the file is reused, the file does not grow.
+        allocator.deallocate(middle, 4 * page_elements);
+        middle = allocator.allocate(2 * page_elements);
+        std::uint32_t *rest = allocator.allocate(2 * page_elements);
+        BOOST_CHECK_EQUAL(std::filesystem::file_size(path), 6 * page_size);
+
+        // A released tail is truncated together with the free regions before it.
+        allocator.deallocate(middle, 2 * page_elements);
+        allocator.deallocate(tail, page_elements);
+        BOOST_CHECK_EQUAL(std::filesystem::file_size(path), 5 * page_size);
+        allocator.deallocate(rest, 2 * page_elements);
+        BOOST_CHECK_EQUAL(std::filesystem::file_size(path), page_size);
+
+        head[0] = 42;
+        allocator.deallocate(head, page_elements);
+        BOOST_CHECK_EQUAL(std::filesystem::file_size(path), page_size);
+    }
+    {
+        // The region at the beginning of the file keeps its contents for a reopening allocator.
+        allocator_type allocator(path);
+        std::uint32_t *head = allocator.allocate(1);
+        BOOST_CHECK_EQUAL(head[0], 42);
+        allocator.deallocate(head, 1);
+    }
+    std::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(merkletree_row_offset_test) {
+    using hash_type = hashes::sha2<256>;
+    auto v = generate_random_data<std::uint8_t, 4>(81);
+    merkle_tree<hash_type, 3> tree = make_merkle_tree<hash_type, 3>(v.begin(), v.end());
+    BOOST_CHECK_EQUAL(tree.row_offset(0), 0);
+    BOOST_CHECK_EQUAL(tree.row_offset(1), 81);
+    BOOST_CHECK_EQUAL(tree.row_offset(2), 81 + 27);
+    BOOST_CHECK_EQUAL(tree.row_offset(3), 81 + 27 + 9);
+    BOOST_CHECK_EQUAL(tree.node_index(tree.row_count() - 1, 0), tree.size() - 1);
+}
+
 
 BOOST_AUTO_TEST_CASE(merkletree_validate_test_1) {
     std::vector<std::array<char, 1>> v = {{'0'}, {'1'}, {'2'}, {'3'}, {'4'}, {'5'}, {'6'}, {'7'}};
@@ -362,6 +497,25 @@ BOOST_AUTO_TEST_CASE(merkletree_validate_test_5) {
     testing_validate_template_random_data_compressed_proofs<hashes::blake2b<224>, 4, std::uint8_t, 1>(leaf_number);
 }
 
+BOOST_AUTO_TEST_CASE(merkletree_construct_ternary_rows_test) {
+    // SHA-256 parents are hashed in batches, 243 parents leave a partial batch and 96-byte messages need two
+    // padding blocks.
+    using hash_type = hashes::sha2<256>;
+    auto v = generate_random_data<std::uint8_t, 4>(729);
+    merkle_tree<hash_type, 3> tree = make_merkle_tree<hash_type, 3>(v.begin(), v.end());
+
+    std::vector<typename hash_type::digest_type> expected;
+    expected.reserve(tree.size());
+    for (const auto &leaf : v) {
+        expected.emplace_back(hash<hash_type>(leaf));
+    }
+    for (std::size_t i = 0; expected.size() < tree.size(); i += 3) {
+        expected.emplace_back(
+            containers::detail::generate_hash<hash_type>(expected.begin() + i, expected.begin() + i + 3));
+    }
+    BOOST_CHECK(std::equal(tree.begin(), tree.end(), expected.begin()));
+}
+
 BOOST_AUTO_TEST_CASE(merkletree_hash_test_1) {
     std::vector<std::array<char, 1>> v = {{'0'}, {'1'}, {'2'}, {'3'}, {'4'}, {'5'}, {'6'}, {'7'}};
     testing_hash_template<hashes::sha2<256>, 2>(v, "3b828c4f4b48c5d4cb5562a474ec9e2fd8d5546fae40e90732ef635892e42720");
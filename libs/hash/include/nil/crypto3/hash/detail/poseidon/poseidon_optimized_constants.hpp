@@ -0,0 +1,206 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_POSEIDON_OPTIMIZED_CONSTANTS_HPP
+#define CRYPTO3_HASH_POSEIDON_OPTIMIZED_CONSTANTS_HPP
+
+#include <array>
+#include <cstddef>
+
+#include <nil/crypto3/hash/detail/poseidon/poseidon_policy.hpp>
+#include <nil/crypto3/hash/detail/poseidon/poseidon_constants.hpp>
+
+#include <boost/assert.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+
+                /**
+                 * Constants of the original Poseidon rearranged for the faster permutation of Appendix B of the
+                 * Poseidon paper, https://eprint.iacr.org/2019/458.pdf. The permutation computes the same
+                 * function as poseidon_round_operator.
+                 *
+                 * Matrices here act on column vectors, the MDS multiplication is x -> M * x.
+                 *
+                 * Partial rounds apply the S-box to x[0] only, everything between two of them is linear:
+                 *  - Only x[0] of the round constants is added in a partial round. The rest of the vector is
+                 *    pushed through the MDS matrix into the constants of the next round, the last partial
+                 *    round leaves it in the constants of the first full round of the second half.
+                 *  - Each MDS matrix is split as M = S * D, where D = diag(1, B) does not touch x[0] and
+                 *    therefore commutes with the S-box, and S = [[m_00, row], [column, I]] is sparse. D is
+                 *    moved into the previous round, where D * M is split again. The D left before the first
+                 *    partial round is applied once as a dense (t - 1) x (t - 1) matrix.
+                 * So each partial round costs 2t - 1 multiplications instead of t^2.
+                 */
+                template<typename PolicyType>
+                class poseidon_optimized_constants {
+                public:
+                    typedef PolicyType policy_type;
+                    typedef typename policy_type::word_type element_type;
+
+                    BOOST_STATIC_ASSERT_MSG(!policy_type::mina_version,
+                                            "Mina version of Poseidon has no partial rounds to optimize.");
+
+                    constexpr static const std::size_t state_words = policy_type::state_words;
+                    constexpr static const std::size_t full_rounds = policy_type::full_rounds;
+                    constexpr static const std::size_t half_full_rounds = policy_type::half_full_rounds;
+                    constexpr static const std::size_t part_rounds = policy_type::part_rounds;
+
+                    typedef std::array<element_type, state_words> state_vector_type;
+                    typedef std::array<state_vector_type, state_words> mds_matrix_type;
+
+                    typedef std::array<element_type, state_words - 1> inner_vector_type;
+                    typedef std::array<inner_vector_type, state_words - 1> inner_matrix_type;
+
+                    // [[m_00, row], [column, I]]
+                    struct sparse_matrix_type {
+                        element_type m_00;
+                        inner_vector_type row;
+                        inner_vector_type column;
+                    };
+
+                    poseidon_optimized_constants() {
+                        typedef typename poseidon_constants<policy_type>::constants_data_type constants_data_type;
+
+                        for (std::size_t i = 0; i < state_words; i++) {
+                            for (std::size_t j = 0; j < state_words; j++) {
+                                mds_matrix[i][j] = constants_data_type::mds_matrix[i][j];
+                            }
+                        }
+                        for (std::size_t r = 0; r < full_rounds; r++) {
+                            const std::size_t round = r < half_full_rounds ? r : r + part_rounds;
+                            for (std::size_t i = 0; i < state_words; i++) {
+                                full_round_constants[r][i] = constants_data_type::round_constants[round][i];
+                            }
+                        }
+
+                        fold_partial_round_constants();
+                        split_partial_round_matrices();
+                    }
+
+                    mds_matrix_type mds_matrix;
+                    std::array<state_vector_type, full_rounds> full_round_constants;
+
+                    inner_matrix_type first_partial_matrix;
+                    std::array<element_type, part_rounds> partial_round_constants;
+                    std::array<sparse_matrix_type, part_rounds> sparse_matrices;
+
+                private:
+                    void fold_partial_round_constants() {
+                        typedef typename poseidon_constants<policy_type>::constants_data_type constants_data_type;
+
+                        state_vector_type carry;
+                        carry.fill(element_type(0u));
+                        for (std::size_t k = 0; k < part_rounds; k++) {
+                            state_vector_type c;
+                            for (std::size_t i = 0; i < state_words; i++) {
+                                c[i] = constants_data_type::round_constants[half_full_rounds + k][i] + carry[i];
+                            }
+                            partial_round_constants[k] = c[0];
+                            c[0] = element_type(0u);
+                            carry = multiply(mds_matrix, c);
+                        }
+                        for (std::size_t i = 0; i < state_words; i++) {
+                            full_round_constants[half_full_rounds][i] += carry[i];
+                        }
+                    }
+
+                    void split_partial_round_matrices() {
+                        mds_matrix_type x = mds_matrix;
+                        for (std::size_t k = part_rounds; k-- > 0;) {
+                            inner_matrix_type b;
+                            inner_vector_type top;
+                            sparse_matrix_type &s = sparse_matrices[k];
+
+                            s.m_00 = x[0][0];
+                            for (std::size_t i = 1; i < state_words; i++) {
+                                s.column[i - 1] = x[i][0];
+                                top[i - 1] = x[0][i];
+                                for (std::size_t j = 1; j < state_words; j++) {
+                                    b[i - 1][j - 1] = x[i][j];
+                                }
+                            }
+                            // row * B = top
+                            s.row = solve_transposed(b, top);
+
+                            if (k == 0) {
+                                first_partial_matrix = b;
+                                break;
+                            }
+                            // diag(1, B) * M
+                            x[0] = mds_matrix[0];
+                            for (std::size_t i = 1; i < state_words; i++) {
+                                for (std::size_t j = 0; j < state_words; j++) {
+                                    x[i][j] = element_type(0u);
+                                    for (std::size_t l = 1; l < state_words; l++) {
+                                        x[i][j] += b[i - 1][l - 1] * mds_matrix[l][j];
+                                    }
+                                }
+                            }
+                        }
+                    }
+
+                    static state_vector_type multiply(const mds_matrix_type &m, const state_vector_type &v) {
+                        state_vector_type result;
+                        for (std::size_t i = 0; i < state_words; i++) {
+                            result[i] = element_type(0u);
+                            for (std::size_t j = 0; j < state_words; j++) {
+                                result[i] += m[i][j] * v[j];
+                            }
+                        }
+                        return result;
+                    }
+
+                    // Solves y * B = u by Gauss-Jordan elimination on B^T. Every square submatrix of an MDS
+                    // matrix is invertible, so B is.
+                    static inner_vector_type solve_transposed(const inner_matrix_type &b, const inner_vector_type &u) {
+                        constexpr std::size_t n = state_words - 1;
+                        std::array<std::array<element_type, n + 1>, n> a;
+                        for (std::size_t i = 0; i < n; i++) {
+                            for (std::size_t j = 0; j < n; j++) {
+                                a[i][j] = b[j][i];
+                            }
+                            a[i][n] = u[i];
+                        }
+                        for (std::size_t col = 0; col < n; col++) {
+                            std::size_t pivot = col;
+                            while (pivot < n && a[pivot][col].is_zero()) {
+                                pivot++;
+                            }
+                            BOOST_ASSERT_MSG(pivot < n, "Poseidon MDS submatrix is singular.");
+                            std::swap(a[col], a[pivot]);
+
+                            const element_type inverse = a[col][col].inversed();
+                            for (std::size_t j = col; j <= n; j++) {
+                                a[col][j] *= inverse;
+                            }
+                            for (std::size_t i = 0; i < n; i++) {
+                                if (i == col || a[i][col].is_zero()) {
+                                    continue;
+                                }
+                                const element_type factor = a[i][col];
+                                for (std::size_t j = col; j <= n; j++) {
+                                    a[i][j] -= factor * a[col][j];
+                                }
+                            }
+                        }
+                        inner_vector_type y;
+                        for (std::size_t i = 0; i < n; i++) {
+                            y[i] = a[i][n];
+                        }
+                        return y;
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_POSEIDON_OPTIMIZED_CONSTANTS_HPP
@@ -10,8 +10,11 @@
 #ifndef CRYPTO3_HASH_POSEIDON_FUNCTIONS_HPP
 #define CRYPTO3_HASH_POSEIDON_FUNCTIONS_HPP
 
+#include <vector>
+
 #include <nil/crypto3/hash/detail/poseidon/poseidon_policy.hpp>
 #include <nil/crypto3/hash/detail/poseidon/poseidon_round_operator.hpp>
+#include <nil/crypto3/hash/detail/poseidon/poseidon_optimized_constants.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -39,7 +42,59 @@ namespace nil {
                     constexpr static const std::size_t word_bits = policy_type::word_bits;
                     typedef typename policy_type::word_type word_type;
 
+                    constexpr static const std::size_t sbox_power = policy_type::sbox_power;
+
                     static inline void permute(state_type &A) {
+                        if constexpr (policy_type::mina_version) {
+                            permute_by_rounds(A);
+                        } else {
+                            permute_many(&A, 1);
+                        }
+                    }
+
+                    /**
+                     * Permutes count independent states. They go through the rounds together, which gives the
+                     * CPU independent multiplications to overlap.
+                     */
+                    static inline void permute_many(state_type *states, std::size_t count) {
+                        if constexpr (policy_type::mina_version) {
+                            for (std::size_t n = 0; n < count; n++) {
+                                permute_by_rounds(states[n]);
+                            }
+                        } else {
+                            const optimized_constants_type &constants = get_optimized_constants();
+
+                            for (std::size_t r = 0; r < half_full_rounds; r++) {
+                                for (std::size_t n = 0; n < count; n++) {
+                                    full_round(states[n], constants.full_round_constants[r], constants.mds_matrix);
+                                }
+                            }
+
+                            for (std::size_t n = 0; n < count; n++) {
+                                inner_product(states[n], constants.first_partial_matrix);
+                            }
+                            for (std::size_t k = 0; k < part_rounds; k++) {
+                                for (std::size_t n = 0; n < count; n++) {
+                                    state_type &A = states[n];
+                                    A[0] = sbox(A[0] + constants.partial_round_constants[k]);
+                                    sparse_product(A, constants.sparse_matrices[k]);
+                                }
+                            }
+
+                            for (std::size_t r = half_full_rounds; r < full_rounds; r++) {
+                                for (std::size_t n = 0; n < count; n++) {
+                                    full_round(states[n], constants.full_round_constants[r], constants.mds_matrix);
+                                }
+                            }
+                        }
+                    }
+
+                    static inline void permute_many(std::vector<state_type> &states) {
+                        permute_many(states.data(), states.size());
+                    }
+
+                    /// Round by round as in the specification, the reference for the optimized permutation.
+                    static inline void permute_by_rounds(state_type &A) {
                         std::size_t round_number = 0;
 
                         // Converting from std::array to algebra::vector here.
@@ -67,6 +122,64 @@ namespace nil {
                             A[i] = A_vector[i];
                         }
                     }
+
+                private:
+                    // Only instantiated for the original version.
+                    typedef poseidon_optimized_constants<policy_type> optimized_constants_type;
+
+                    static const optimized_constants_type &get_optimized_constants() {
+                        static const optimized_constants_type constants;
+                        return constants;
+                    }
+
+                    static inline element_type sbox(const element_type &x) {
+                        if constexpr (sbox_power == 5) {
+                            const element_type x2 = x.squared();
+                            return x2.squared() * x;
+                        } else {
+                            return x.pow(sbox_power);
+                        }
+                    }
+
+                    template<typename RoundConstants, typename MdsMatrix>
+                    static inline void full_round(state_type &A, const RoundConstants &round_constants,
+                                                  const MdsMatrix &mds_matrix) {
+                        for (std::size_t i = 0; i < state_words; i++) {
+                            A[i] = sbox(A[i] + round_constants[i]);
+                        }
+                        state_type result;
+                        for (std::size_t i = 0; i < state_words; i++) {
+                            result[i] = mds_matrix[i][0] * A[0];
+                            for (std::size_t j = 1; j < state_words; j++) {
+                                result[i] += mds_matrix[i][j] * A[j];
+                            }
+                        }
+                        A = result;
+                    }
+
+                    // A[1..] = B * A[1..]
+                    template<typename InnerMatrix>
+                    static inline void inner_product(state_type &A, const InnerMatrix &b) {
+                        state_type result = A;
+                        for (std::size_t i = 1; i < state_words; i++) {
+                            result[i] = b[i - 1][0] * A[1];
+                            for (std::size_t j = 2; j < state_words; j++) {
+                                result[i] += b[i - 1][j - 1] * A[j];
+                            }
+                        }
+                        A = result;
+                    }
+
+                    template<typename SparseMatrix>
+                    static inline void sparse_product(state_type &A, const SparseMatrix &s) {
+                        const element_type a_0 = A[0];
+                        element_type result_0 = s.m_00 * a_0;
+                        for (std::size_t i = 1; i < state_words; i++) {
+                            result_0 += s.row[i - 1] * A[i];
+                            A[i] += s.column[i - 1] * a_0;
+                        }
+                        A[0] = result_0;
+                    }
                 };
             }    // namespace detail
         }        // namespace hashes
@@ -71,7 +71,7 @@ namespace nil {
                 private:
                     // Contains all the constants: mds matrix and round constants.
                     // Default constructor selects the right ones.
-                    static const poseidon_constants<poseidon_policy_type> get_constants() {
+                    static const poseidon_constants<poseidon_policy_type> &get_constants() {
                         static const poseidon_constants<poseidon_policy_type> constants;
                         return constants;
                     }
@@ -126,7 +126,7 @@ namespace nil {
                 private:
                     // Contains all the constants: mds matrix and round constants.
                     // Default constructor selects the right ones.
-                    static const poseidon_constants<poseidon_policy_type> get_constants() {
+                    static const poseidon_constants<poseidon_policy_type> &get_constants() {
                         static const poseidon_constants<poseidon_policy_type> constants;
                         return constants;
                     }
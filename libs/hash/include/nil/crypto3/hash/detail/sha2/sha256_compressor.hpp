@@ -0,0 +1,377 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file SHA-256 compression function with the SHA extensions and an 8-lane AVX2 multi-buffer kernel.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_DETAIL_SHA256_COMPRESSOR_HPP
+#define CRYPTO3_HASH_DETAIL_SHA256_COMPRESSOR_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <nil/crypto3/block/shacal2.hpp>
+
+#include <nil/crypto3/hash/detail/state_adder.hpp>
+#include <nil/crypto3/hash/detail/davies_meyer_compressor.hpp>
+
+#include <nil/crypto3/multiprecision/detail/cpu_features.hpp>
+
+#ifdef CRYPTO3_MP_X86_CPU_FEATURES
+#define CRYPTO3_HASH_SHA256_X86_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+
+#ifdef CRYPTO3_HASH_SHA256_X86_DISPATCH
+#define CRYPTO3_SHA256_NI __attribute__((target("sha,sse4.1")))
+#define CRYPTO3_SHA256_AVX2 __attribute__((target("avx2")))
+#endif
+
+                /**
+                 * The instruction sets used by sha256_compressor, derived from the probe shared with the
+                 * field and Montgomery kernels. The AVX2 bit already requires the OS to save the YMM registers.
+                 */
+                struct sha256_cpu_features {
+                    bool sha = false;
+                    bool avx2 = false;
+
+                    static const sha256_cpu_features &get() {
+                        static const sha256_cpu_features features = detect();
+                        return features;
+                    }
+
+                private:
+                    static sha256_cpu_features detect() {
+                        sha256_cpu_features result;
+#ifdef CRYPTO3_HASH_SHA256_X86_DISPATCH
+                        const auto &cpu = boost::multiprecision::backends::cpu_features::get();
+                        result.sha = cpu.sse41 && cpu.sha;
+                        result.avx2 = cpu.avx2;
+#endif
+                        return result;
+                    }
+                };
+
+                /**
+                 * SHA-256 compression function, a drop-in replacement of
+                 * davies_meyer_compressor<block::shacal2<256>, state_adder>. Single blocks are compressed
+                 * with the SHA extensions when the CPU has them and with the portable SHACAL-2 otherwise.
+                 *
+                 * hash_many hashes a batch of equal-length messages. With AVX2 it runs 8 messages through
+                 * the rounds at once, one message per 32-bit lane. The messages left over are hashed one
+                 * by one with process_block.
+                 */
+                struct sha256_compressor {
+                    typedef block::shacal2<256> block_cipher_type;
+                    typedef davies_meyer_compressor<block_cipher_type, state_adder> portable_compressor_type;
+
+                    constexpr static const std::size_t word_bits = block_cipher_type::word_bits;
+                    typedef typename block_cipher_type::word_type word_type;
+
+                    constexpr static const std::size_t state_bits = block_cipher_type::block_bits;
+                    constexpr static const std::size_t state_words = block_cipher_type::block_words;
+                    typedef typename block_cipher_type::block_type state_type;
+
+                    constexpr static const std::size_t block_bits = block_cipher_type::key_bits;
+                    constexpr static const std::size_t block_words = block_cipher_type::key_words;
+                    typedef typename block_cipher_type::key_type block_type;
+
+                    constexpr static const std::size_t block_bytes = block_bits / 8;
+                    constexpr static const std::size_t digest_bytes = state_bits / 8;
+                    constexpr static const std::size_t lanes = 8;
+
+                    inline static void process_block(state_type &state, const block_type &block) {
+#ifdef CRYPTO3_HASH_SHA256_X86_DISPATCH
+                        if (sha256_cpu_features::get().sha) {
+                            process_block_sha_ni(state, block);
+                            return;
+                        }
+#endif
+                        portable_compressor_type::process_block(state, block);
+                    }
+
+                    /**
+                     * Computes SHA-256 of count messages of message_size bytes each, stored back to back in
+                     * messages. The 32-byte digests are written back to back into digests.
+                     */
+                    static void hash_many(const std::uint8_t *messages, std::size_t message_size, std::size_t count,
+                                          std::uint8_t *digests) {
+                        std::size_t done = 0;
+#ifdef CRYPTO3_HASH_SHA256_X86_DISPATCH
+                        // 8 AVX2 lanes outrun a single SHA-NI stream on the machines we measured.
+                        if (sha256_cpu_features::get().avx2) {
+                            for (; done + lanes <= count; done += lanes) {
+                                hash_lanes_avx2(messages + done * message_size, message_size,
+                                                digests + done * digest_bytes);
+                            }
+                        }
+#endif
+                        for (; done < count; ++done) {
+                            hash_one(messages + done * message_size, message_size, digests + done * digest_bytes);
+                        }
+                    }
+
+                private:
+                    static const state_type &initial_state() {
+                        static const state_type H0 = {{0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f,
+                                                       0x9b05688c, 0x1f83d9ab, 0x5be0cd19}};
+                        return H0;
+                    }
+
+                    static word_type load_big_endian(const std::uint8_t *p) {
+                        return (word_type(p[0]) << 24) | (word_type(p[1]) << 16) | (word_type(p[2]) << 8) |
+                               word_type(p[3]);
+                    }
+
+                    static void store_big_endian(std::uint8_t *p, word_type w) {
+                        p[0] = std::uint8_t(w >> 24);
+                        p[1] = std::uint8_t(w >> 16);
+                        p[2] = std::uint8_t(w >> 8);
+                        p[3] = std::uint8_t(w);
+                    }
+
+                    // The bytes of a message left after its full blocks, followed by the Merkle-Damgard
+                    // padding. Has the same number of blocks for all the messages of a given size.
+                    static std::size_t pad_tail(const std::uint8_t *message, std::size_t message_size,
+                                                std::uint8_t (&tail)[2 * block_bytes]) {
+                        const std::size_t full_blocks = message_size / block_bytes;
+                        const std::size_t rest = message_size - full_blocks * block_bytes;
+                        const std::size_t tail_blocks = rest + 9 <= block_bytes ? 1 : 2;
+
+                        std::memset(tail, 0, sizeof(tail));
+                        std::memcpy(tail, message + full_blocks * block_bytes, rest);
+                        tail[rest] = 0x80;
+                        const std::uint64_t length_bits = std::uint64_t(message_size) * 8;
+                        for (std::size_t i = 0; i < 8; ++i) {
+                            tail[tail_blocks * block_bytes - 1 - i] = std::uint8_t(length_bits >> (8 * i));
+                        }
+                        return tail_blocks;
+                    }
+
+                    static void hash_one(const std::uint8_t *message, std::size_t message_size,
+                                         std::uint8_t *digest) {
+                        state_type state = initial_state();
+                        block_type block;
+
+                        const std::size_t full_blocks = message_size / block_bytes;
+                        for (std::size_t b = 0; b < full_blocks; ++b) {
+                            for (std::size_t i = 0; i < block_words; ++i) {
+                                block[i] = load_big_endian(message + b * block_bytes + 4 * i);
+                            }
+                            process_block(state, block);
+                        }
+
+                        std::uint8_t tail[2 * block_bytes];
+                        const std::size_t tail_blocks = pad_tail(message, message_size, tail);
+                        for (std::size_t b = 0; b < tail_blocks; ++b) {
+                            for (std::size_t i = 0; i < block_words; ++i) {
+                                block[i] = load_big_endian(tail + b * block_bytes + 4 * i);
+                            }
+                            process_block(state, block);
+                        }
+
+                        for (std::size_t i = 0; i < state_words; ++i) {
+                            store_big_endian(digest + 4 * i, state[i]);
+                        }
+                    }
+
+#ifdef CRYPTO3_HASH_SHA256_X86_DISPATCH
+                    static const word_type *round_constants() {
+                        return block::detail::shacal2_policy<256>::constants.data();
+                    }
+
+                    // Follows Intel's reference for the SHA extensions. The block already holds native words,
+                    // so no byte shuffle is needed. The state is kept as ABEF and CDGH.
+                    CRYPTO3_SHA256_NI static void process_block_sha_ni(state_type &state, const block_type &block) {
+                        const word_type *k = round_constants();
+
+                        __m128i tmp = _mm_loadu_si128(reinterpret_cast<const __m128i *>(state.data()));
+                        __m128i state1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(state.data() + 4));
+                        tmp = _mm_shuffle_epi32(tmp, 0xB1);       // CDAB
+                        state1 = _mm_shuffle_epi32(state1, 0x1B);    // EFGH
+                        __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);    // ABEF
+                        state1 = _mm_blend_epi16(state1, tmp, 0xF0);         // CDGH
+
+                        const __m128i abef_save = state0;
+                        const __m128i cdgh_save = state1;
+
+                        __m128i msgs[4];
+                        for (std::size_t i = 0; i < 4; ++i) {
+                            msgs[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block.data() + 4 * i));
+                        }
+
+                        for (std::size_t i = 0; i < 16; ++i) {
+                            __m128i msg = _mm_add_epi32(msgs[i & 3],
+                                                        _mm_loadu_si128(reinterpret_cast<const __m128i *>(k + 4 * i)));
+                            state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+                            msg = _mm_shuffle_epi32(msg, 0x0E);
+                            state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+
+                            if (i < 12) {
+                                // W[16 + 4i .. 19 + 4i] from the four previous message vectors.
+                                __m128i next = _mm_sha256msg1_epu32(msgs[i & 3], msgs[(i + 1) & 3]);
+                                next = _mm_add_epi32(next, _mm_alignr_epi8(msgs[(i + 3) & 3], msgs[(i + 2) & 3], 4));
+                                msgs[i & 3] = _mm_sha256msg2_epu32(next, msgs[(i + 3) & 3]);
+                            }
+                        }
+
+                        state0 = _mm_add_epi32(state0, abef_save);
+                        state1 = _mm_add_epi32(state1, cdgh_save);
+
+                        tmp = _mm_shuffle_epi32(state0, 0x1B);       // FEBA
+                        state1 = _mm_shuffle_epi32(state1, 0xB1);    // DCHG
+                        state0 = _mm_blend_epi16(tmp, state1, 0xF0);    // DCBA
+                        state1 = _mm_alignr_epi8(state1, tmp, 8);       // ABEF
+
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(state.data()), state0);
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(state.data() + 4), state1);
+                    }
+
+                    CRYPTO3_SHA256_AVX2 static __m256i rotr8(__m256i x, int n) {
+                        return _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - n));
+                    }
+
+                    // One block of 8 independent messages, w[t] holds word t of every lane.
+                    CRYPTO3_SHA256_AVX2 static void compress8(__m256i (&s)[8], __m256i (&w)[16]) {
+                        const word_type *k = round_constants();
+
+                        __m256i a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
+                        for (std::size_t t = 0; t < 64; ++t) {
+                            __m256i wt;
+                            if (t < 16) {
+                                wt = w[t];
+                            } else {
+                                const __m256i w15 = w[(t - 15) & 15];
+                                const __m256i w2 = w[(t - 2) & 15];
+                                const __m256i sigma0 = _mm256_xor_si256(
+                                    _mm256_xor_si256(rotr8(w15, 7), rotr8(w15, 18)), _mm256_srli_epi32(w15, 3));
+                                const __m256i sigma1 = _mm256_xor_si256(
+                                    _mm256_xor_si256(rotr8(w2, 17), rotr8(w2, 19)), _mm256_srli_epi32(w2, 10));
+                                wt = _mm256_add_epi32(_mm256_add_epi32(w[t & 15], sigma0),
+                                                      _mm256_add_epi32(w[(t - 7) & 15], sigma1));
+                                w[t & 15] = wt;
+                            }
+
+                            const __m256i big_sigma1 =
+                                _mm256_xor_si256(_mm256_xor_si256(rotr8(e, 6), rotr8(e, 11)), rotr8(e, 25));
+                            const __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+                            const __m256i t1 = _mm256_add_epi32(
+                                _mm256_add_epi32(_mm256_add_epi32(h, big_sigma1), _mm256_add_epi32(ch, wt)),
+                                _mm256_set1_epi32(static_cast<int>(k[t])));
+                            const __m256i big_sigma0 =
+                                _mm256_xor_si256(_mm256_xor_si256(rotr8(a, 2), rotr8(a, 13)), rotr8(a, 22));
+                            const __m256i maj = _mm256_or_si256(_mm256_and_si256(a, b),
+                                                                _mm256_and_si256(c, _mm256_or_si256(a, b)));
+                            const __m256i t2 = _mm256_add_epi32(big_sigma0, maj);
+
+                            h = g;
+                            g = f;
+                            f = e;
+                            e = _mm256_add_epi32(d, t1);
+                            d = c;
+                            c = b;
+                            b = a;
+                            a = _mm256_add_epi32(t1, t2);
+                        }
+
+                        s[0] = _mm256_add_epi32(s[0], a);
+                        s[1] = _mm256_add_epi32(s[1], b);
+                        s[2] = _mm256_add_epi32(s[2], c);
+                        s[3] = _mm256_add_epi32(s[3], d);
+                        s[4] = _mm256_add_epi32(s[4], e);
+                        s[5] = _mm256_add_epi32(s[5], f);
+                        s[6] = _mm256_add_epi32(s[6], g);
+                        s[7] = _mm256_add_epi32(s[7], h);
+                    }
+
+                    CRYPTO3_SHA256_AVX2 static void load_lanes(const std::uint8_t *const (&blocks)[lanes],
+                                                               __m256i (&w)[16]) {
+                        alignas(32) word_type words[lanes];
+                        for (std::size_t i = 0; i < block_words; ++i) {
+                            for (std::size_t lane = 0; lane < lanes; ++lane) {
+                                words[lane] = load_big_endian(blocks[lane] + 4 * i);
+                            }
+                            w[i] = _mm256_load_si256(reinterpret_cast<const __m256i *>(words));
+                        }
+                    }
+
+                    CRYPTO3_SHA256_AVX2 static void hash_lanes_avx2(const std::uint8_t *messages,
+                                                                    std::size_t message_size, std::uint8_t *digests) {
+                        __m256i s[8];
+                        for (std::size_t i = 0; i < state_words; ++i) {
+                            s[i] = _mm256_set1_epi32(static_cast<int>(initial_state()[i]));
+                        }
+
+                        __m256i w[16];
+                        const std::uint8_t *blocks[lanes];
+
+                        const std::size_t full_blocks = message_size / block_bytes;
+                        for (std::size_t b = 0; b < full_blocks; ++b) {
+                            for (std::size_t lane = 0; lane < lanes; ++lane) {
+                                blocks[lane] = messages + lane * message_size + b * block_bytes;
+                            }
+                            load_lanes(blocks, w);
+                            compress8(s, w);
+                        }
+
+                        std::uint8_t tails[lanes][2 * block_bytes];
+                        std::size_t tail_blocks = 0;
+                        for (std::size_t lane = 0; lane < lanes; ++lane) {
+                            tail_blocks = pad_tail(messages + lane * message_size, message_size, tails[lane]);
+                        }
+                        for (std::size_t b = 0; b < tail_blocks; ++b) {
+                            for (std::size_t lane = 0; lane < lanes; ++lane) {
+                                blocks[lane] = tails[lane] + b * block_bytes;
+                            }
+                            load_lanes(blocks, w);
+                            compress8(s, w);
+                        }
+
+                        alignas(32) word_type words[lanes];
+                        for (std::size_t i = 0; i < state_words; ++i) {
+                            _mm256_store_si256(reinterpret_cast<__m256i *>(words), s[i]);
+                            for (std::size_t lane = 0; lane < lanes; ++lane) {
+                                store_big_endian(digests + lane * digest_bytes + 4 * i, words[lane]);
+                            }
+                        }
+                    }
+#endif
+                };
+
+#ifdef CRYPTO3_HASH_SHA256_X86_DISPATCH
+#undef CRYPTO3_SHA256_NI
+#undef CRYPTO3_SHA256_AVX2
+#endif
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_DETAIL_SHA256_COMPRESSOR_HPP
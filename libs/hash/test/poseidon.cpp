@@ -29,6 +29,7 @@
 #include <nil/crypto3/algebra/fields/alt_bn128/scalar_field.hpp>
 #include <nil/crypto3/algebra/fields/bls12/scalar_field.hpp>
 #include <nil/crypto3/algebra/fields/pallas/base_field.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
 
 using namespace nil::crypto3;
 using namespace nil::crypto3::accumulators;
@@ -98,6 +99,36 @@ void test_poseidon_permutation(
     BOOST_CHECK_EQUAL(input, expected_result);
 }
 
+template<typename FieldType, size_t Rate>
+void test_poseidon_optimized_permutation() {
+    using policy = poseidon_policy<FieldType, 128, Rate>;
+    using permutation = poseidon_permutation<policy>;
+    using state_type = typename policy::state_type;
+
+    std::vector<state_type> states(11);
+    for (auto &state : states) {
+        for (auto &word : state) {
+            word = nil::crypto3::algebra::random_element<FieldType>();
+        }
+    }
+
+    std::vector<state_type> expected = states;
+    for (auto &state : expected) {
+        permutation::permute_by_rounds(state);
+    }
+
+    std::vector<state_type> single = states;
+    for (auto &state : single) {
+        permutation::permute(state);
+    }
+    permutation::permute_many(states);
+
+    for (std::size_t i = 0; i < states.size(); i++) {
+        BOOST_CHECK_EQUAL(single[i], expected[i]);
+        BOOST_CHECK_EQUAL(states[i], expected[i]);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE(poseidon_tests)
 
 // Test data for Mina version was taken from https://github.com/o1-labs/proof-systems/blob/a36c088b3e81d17f5720abfff82a49cf9cb1ad5b/poseidon/src/tests/test_vectors/kimchi.json.
@@ -213,6 +244,13 @@ BOOST_AUTO_TEST_SUITE(poseidon_tests)
         );
     }
 
+    BOOST_AUTO_TEST_CASE(poseidon_optimized_permutation_test) {
+        test_poseidon_optimized_permutation<fields::alt_bn128_scalar_field<254>, 2>();
+        test_poseidon_optimized_permutation<fields::alt_bn128_scalar_field<254>, 4>();
+        test_poseidon_optimized_permutation<fields::bls12_scalar_field<381>, 2>();
+        test_poseidon_optimized_permutation<fields::bls12_scalar_field<381>, 4>();
+    }
+
     BOOST_AUTO_TEST_CASE(nil_poseidon_accumulator_255_4) {
         using policy = poseidon_policy<fields::bls12_scalar_field<381>, 128, /*Rate=*/ 4>;
         using hash_t = hashes::poseidon<policy>;
@@ -26,6 +26,7 @@
 #define BOOST_TEST_MODULE sha2_test
 
 #include <iostream>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -687,3 +688,50 @@ BOOST_AUTO_TEST_CASE(sha224_range_hash) {
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(sha256_compressor_test_suite)
+
+BOOST_AUTO_TEST_CASE(sha256_compressor_process_block) {
+    typedef hashes::detail::sha256_compressor compressor_type;
+    typedef hashes::detail::sha256_compressor::portable_compressor_type portable_compressor_type;
+
+    compressor_type::state_type state = {
+        {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19}};
+    compressor_type::state_type expected = state;
+    for (std::uint32_t round = 0; round < 16; ++round) {
+        compressor_type::block_type block;
+        for (std::size_t i = 0; i < block.size(); ++i) {
+            block[i] = 0x9e3779b9 * (round * 16 + i + 1);
+        }
+        compressor_type::process_block(state, block);
+        portable_compressor_type::process_block(expected, block);
+        BOOST_CHECK(state == expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sha256_compressor_hash_many) {
+    typedef hashes::sha2<256> hash_type;
+    typedef hashes::detail::sha256_compressor compressor_type;
+
+    // Tails of 0, 1 and 2 padding blocks, and counts not divisible by the number of lanes.
+    for (std::size_t message_size : {0, 3, 55, 56, 64, 96, 119, 200}) {
+        for (std::size_t count : {1, 8, 13}) {
+            std::vector<std::uint8_t> messages(message_size * count);
+            for (std::size_t i = 0; i < messages.size(); ++i) {
+                messages[i] = static_cast<std::uint8_t>(i * 131 + message_size);
+            }
+            std::vector<std::uint8_t> digests(compressor_type::digest_bytes * count);
+            compressor_type::hash_many(messages.data(), message_size, count, digests.data());
+
+            for (std::size_t i = 0; i < count; ++i) {
+                std::vector<std::uint8_t> message(messages.begin() + i * message_size,
+                                                  messages.begin() + (i + 1) * message_size);
+                hash_type::digest_type expected = hash<hash_type>(message);
+                BOOST_CHECK(std::equal(expected.begin(), expected.end(),
+                                       digests.begin() + i * compressor_type::digest_bytes));
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
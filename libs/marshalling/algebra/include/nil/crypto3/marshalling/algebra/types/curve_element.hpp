@@ -38,6 +38,8 @@
 #include <nil/marshalling/types/tag.hpp>
 #include <nil/marshalling/types/detail/adapt_basic_field.hpp>
 
+#include <nil/crypto3/algebra/curves/detail/subgroup_check.hpp>
+
 #include <nil/crypto3/marshalling/algebra/types/detail/curve_element/basic_type.hpp>
 #include <nil/crypto3/marshalling/algebra/inference.hpp>
 #include <nil/crypto3/marshalling/algebra/type_traits.hpp>
@@ -402,6 +404,27 @@ namespace nil {
                     }
                     return result;
                 }
+
+                /// @brief Same as make_curve_element_vector, additionally checks that all the points are elements
+                ///     of the subgroup of prime order. The check is batched, see
+                ///     nil::crypto3::algebra::curves::detail::batch_subgroup_check, which makes it affordable for
+                ///     large key files.
+                template<typename CurveGroupType, typename Endianness>
+                nil::marshalling::status_type make_checked_curve_element_vector(
+                    const nil::marshalling::types::array_list<
+                        nil::marshalling::field_type<Endianness>,
+                        curve_element<nil::marshalling::field_type<Endianness>, CurveGroupType>,
+                        nil::marshalling::option::sequence_size_field_prefix<
+                            nil::marshalling::types::integral<nil::marshalling::field_type<Endianness>, std::size_t>>>
+                        &curve_elem_vector,
+                    std::vector<typename CurveGroupType::value_type> &result) {
+
+                    result = make_curve_element_vector<CurveGroupType, Endianness>(curve_elem_vector);
+                    if (!nil::crypto3::algebra::curves::detail::batch_subgroup_check(result.begin(), result.end())) {
+                        return nil::marshalling::status_type::invalid_msg_data;
+                    }
+                    return nil::marshalling::status_type::success;
+                }
             }    // namespace types
         }        // namespace marshalling
     }            // namespace crypto3
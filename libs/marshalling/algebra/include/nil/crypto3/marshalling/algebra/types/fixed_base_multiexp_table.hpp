@@ -0,0 +1,94 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MARSHALLING_FIXED_BASE_MULTIEXP_TABLE_HPP
+#define CRYPTO3_MARSHALLING_FIXED_BASE_MULTIEXP_TABLE_HPP
+
+#include <nil/marshalling/types/bundle.hpp>
+#include <nil/marshalling/types/array_list.hpp>
+#include <nil/marshalling/types/integral.hpp>
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/options.hpp>
+
+#include <nil/crypto3/algebra/multiexp/fixed_base_multiexp.hpp>
+
+#include <nil/crypto3/marshalling/algebra/types/fast_curve_element.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+
+                /*
+                 * Points of the table are stored as uncompressed affine points, so that loading a table
+                 * does not pay for the point decompression.
+                 *
+                 * A table is marshalled on its own, next to the SRS it was built from: the KZG params and
+                 * the r1cs_gg_ppzksnark proving key formats do not include it. After loading the params, the
+                 * table read by make_fixed_base_multiexp_table is assigned to commitment_key_table of the KZG
+                 * params, or to H_query_table and L_query_table of the proving key.
+                 */
+                template<typename TTypeBase, typename CurveGroupType>
+                using fixed_base_multiexp_table = nil::marshalling::types::bundle<
+                    TTypeBase,
+                    std::tuple<
+                        // window_size
+                        nil::marshalling::types::integral<TTypeBase, std::size_t>,
+                        // windows_count
+                        nil::marshalling::types::integral<TTypeBase, std::size_t>,
+                        // points
+                        nil::marshalling::types::array_list<
+                            TTypeBase,
+                            fast_curve_element<TTypeBase, CurveGroupType>,
+                            nil::marshalling::option::sequence_size_field_prefix<
+                                nil::marshalling::types::integral<TTypeBase, std::size_t>>>>>;
+
+                template<typename CurveGroupType, typename Endianness>
+                fixed_base_multiexp_table<nil::marshalling::field_type<Endianness>, CurveGroupType>
+                    fill_fixed_base_multiexp_table(
+                        const algebra::fixed_base_multiexp_table<typename CurveGroupType::value_type> &table) {
+
+                    using TTypeBase = nil::marshalling::field_type<Endianness>;
+
+                    return fixed_base_multiexp_table<TTypeBase, CurveGroupType>(std::make_tuple(
+                        nil::marshalling::types::integral<TTypeBase, std::size_t>(table.window_size),
+                        nil::marshalling::types::integral<TTypeBase, std::size_t>(table.windows_count),
+                        fill_fast_curve_element_vector<CurveGroupType, Endianness>(table.points)));
+                }
+
+                template<typename CurveGroupType, typename Endianness>
+                algebra::fixed_base_multiexp_table<typename CurveGroupType::value_type> make_fixed_base_multiexp_table(
+                    const fixed_base_multiexp_table<nil::marshalling::field_type<Endianness>, CurveGroupType>
+                        &filled_table) {
+
+                    return algebra::fixed_base_multiexp_table<typename CurveGroupType::value_type>(
+                        std::get<0>(filled_table.value()).value(),
+                        std::get<1>(filled_table.value()).value(),
+                        make_fast_curve_element_vector<CurveGroupType, Endianness>(std::get<2>(filled_table.value())));
+                }
+            }    // namespace types
+        }        // namespace marshalling
+    }            // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_FIXED_BASE_MULTIEXP_TABLE_HPP
@@ -106,4 +106,39 @@ BOOST_AUTO_TEST_CASE(curve_element_non_fixed_size_container_bls12_381_g2) {
     std::cout << "BLS12-381 g2 group non fixed size container test finished" << std::endl;
 }
 
+BOOST_AUTO_TEST_CASE(curve_element_checked_vector_bls12_381_g1) {
+    using curve_group_type = nil::crypto3::algebra::curves::bls12<381>::g1_type<>;
+    using endianness = nil::marshalling::option::big_endian;
+
+    std::vector<typename curve_group_type::value_type> val_container(100);
+    for (std::size_t i = 0; i < val_container.size(); i++) {
+        val_container[i] = nil::crypto3::algebra::random_element<curve_group_type>();
+    }
+
+    auto filled = nil::crypto3::marshalling::types::fill_curve_element_vector<curve_group_type, endianness>(
+        val_container);
+    std::vector<typename curve_group_type::value_type> result;
+    BOOST_CHECK(nil::crypto3::marshalling::types::make_checked_curve_element_vector<curve_group_type, endianness>(
+                    filled, result) == nil::marshalling::status_type::success);
+    BOOST_CHECK(result == val_container);
+
+    // A point of the curve outside the subgroup of prime order is rejected.
+    using field_value_type = typename curve_group_type::field_type::value_type;
+    using scalar_field_type = typename curve_group_type::curve_type::scalar_field_type;
+    typename curve_group_type::value_type outside;
+    field_value_type x = field_value_type::one();
+    do {
+        x += field_value_type::one();
+        const field_value_type y2 = x.pow(3u) + field_value_type(curve_group_type::params_type::b);
+        if (y2.is_square()) {
+            outside = typename curve_group_type::value_type(x, y2.sqrt(), field_value_type::one());
+        }
+    } while (!outside.is_well_formed() || outside.is_zero() || (outside * scalar_field_type::modulus).is_zero());
+    val_container[val_container.size() / 2] = outside + val_container[val_container.size() / 2];
+
+    filled = nil::crypto3::marshalling::types::fill_curve_element_vector<curve_group_type, endianness>(val_container);
+    BOOST_CHECK(nil::crypto3::marshalling::types::make_checked_curve_element_vector<curve_group_type, endianness>(
+                    filled, result) == nil::marshalling::status_type::invalid_msg_data);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
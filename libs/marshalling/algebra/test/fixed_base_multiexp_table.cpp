@@ -0,0 +1,83 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE crypto3_marshalling_fixed_base_multiexp_table_test
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/endianness.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+
+#include <nil/crypto3/marshalling/algebra/types/fixed_base_multiexp_table.hpp>
+
+template<typename CurveGroup, typename Endianness>
+void test_fixed_base_multiexp_table(std::size_t size) {
+    using namespace nil::crypto3::marshalling;
+    using table_marshalling_type =
+        types::fixed_base_multiexp_table<nil::marshalling::field_type<Endianness>, CurveGroup>;
+
+    std::vector<typename CurveGroup::value_type> bases(size);
+    for (auto &base : bases) {
+        base = nil::crypto3::algebra::random_element<CurveGroup>();
+    }
+    bases[0] = CurveGroup::value_type::zero();
+
+    auto table = nil::crypto3::algebra::make_fixed_base_multiexp_table(bases.begin(), bases.end(), 255);
+
+    auto filled_table = types::fill_fixed_base_multiexp_table<CurveGroup, Endianness>(table);
+
+    std::vector<std::uint8_t> cv(filled_table.length(), 0x00);
+    auto write_iter = cv.begin();
+    nil::marshalling::status_type status = filled_table.write(write_iter, cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+    table_marshalling_type test_val_read;
+    auto read_iter = cv.begin();
+    status = test_val_read.read(read_iter, cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+    auto constructed_table = types::make_fixed_base_multiexp_table<CurveGroup, Endianness>(test_val_read);
+    BOOST_CHECK(table == constructed_table);
+}
+
+BOOST_AUTO_TEST_SUITE(fixed_base_multiexp_table_test_suite)
+
+BOOST_AUTO_TEST_CASE(fixed_base_multiexp_table_bls12_381_g1) {
+    test_fixed_base_multiexp_table<nil::crypto3::algebra::curves::bls12<381>::g1_type<>,
+                                   nil::marshalling::option::big_endian>(16);
+}
+
+BOOST_AUTO_TEST_CASE(fixed_base_multiexp_table_bn254_g1) {
+    test_fixed_base_multiexp_table<nil::crypto3::algebra::curves::alt_bn128_254::g1_type<>,
+                                   nil::marshalling::option::little_endian>(16);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
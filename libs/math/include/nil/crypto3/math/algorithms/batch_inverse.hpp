@@ -0,0 +1,98 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_BATCH_INVERSE_HPP
+#define CRYPTO3_MATH_BATCH_INVERSE_HPP
+
+#include <iterator>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+
+            /**
+             * Replaces every element of [first, last) with its inverse using Montgomery's trick,
+             * which costs a single field inversion and 3(n - 1) multiplications.
+             * Zero elements are left unchanged.
+             */
+            template<typename RandomAccessIterator>
+            void batch_inverse(RandomAccessIterator first, RandomAccessIterator last) {
+                typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+
+                const std::size_t n = std::distance(first, last);
+                if (n == 0) {
+                    return;
+                }
+
+                // prefix_products[i] is the product of all the non-zero values[0], ..., values[i]
+                std::vector<value_type> prefix_products(n);
+                value_type acc = value_type::one();
+                for (std::size_t i = 0; i < n; ++i) {
+                    if (!first[i].is_zero()) {
+                        acc *= first[i];
+                    }
+                    prefix_products[i] = acc;
+                }
+
+                // acc_inversed is the inverse of the product of all the non-zero values[0], ..., values[i]
+                value_type acc_inversed = acc.inversed();
+                for (std::size_t i = n - 1; i > 0; --i) {
+                    if (first[i].is_zero()) {
+                        continue;
+                    }
+                    const value_type inversed = acc_inversed * prefix_products[i - 1];
+                    acc_inversed *= first[i];
+                    first[i] = inversed;
+                }
+                if (!first[0].is_zero()) {
+                    first[0] = acc_inversed;
+                }
+            }
+
+            /**
+             * Replaces every element of the range with its inverse, see batch_inverse above.
+             */
+            template<typename Range>
+            void batch_inverse(Range &values) {
+                batch_inverse(std::begin(values), std::end(values));
+            }
+
+            /**
+             * Returns the inverses of the elements of the range, see batch_inverse.
+             */
+            template<typename Range>
+            std::vector<typename std::iterator_traits<decltype(std::begin(std::declval<const Range &>()))>::value_type>
+                batch_inversed(const Range &values) {
+                std::vector<
+                    typename std::iterator_traits<decltype(std::begin(std::declval<const Range &>()))>::value_type>
+                    result(std::begin(values), std::end(values));
+                batch_inverse(result);
+                return result;
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_BATCH_INVERSE_HPP
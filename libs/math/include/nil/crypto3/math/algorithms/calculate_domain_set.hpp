@@ -41,7 +41,7 @@ namespace nil {
                 for (std::size_t i = 0; i < set_size; i++) {
                     const std::size_t domain_size = std::pow(2, max_domain_degree - i);
                     std::shared_ptr<evaluation_domain<FieldType>> domain =
-                        make_evaluation_domain<FieldType>(domain_size);
+                        get_cached_evaluation_domain<FieldType>(domain_size);
                     domain_set[i] = domain;
                 }
                 return domain_set;
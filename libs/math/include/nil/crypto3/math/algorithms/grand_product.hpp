@@ -0,0 +1,148 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_GRAND_PRODUCT_HPP
+#define CRYPTO3_MATH_GRAND_PRODUCT_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/math/algorithms/batch_inverse.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace detail {
+                // Below this many elements per thread splitting the work costs more than it saves.
+                constexpr static const std::size_t grand_product_min_chunk_size = 1024;
+
+                inline std::size_t grand_product_chunks(std::size_t n) {
+#ifdef MULTICORE
+                    const std::size_t threads = omp_get_max_threads();    // to override, set OMP_NUM_THREADS env var
+                                                                          // or call omp_set_num_threads()
+#else
+                    const std::size_t threads = 1;
+#endif
+                    return std::max<std::size_t>(1, std::min(threads, n / grand_product_min_chunk_size));
+                }
+            }    // namespace detail
+
+            /**
+             * Replaces every element of [first, last) with its inverse, see batch_inverse. The range is split
+             * into one chunk per thread, each chunk costs one field inversion.
+             */
+            template<typename RandomAccessIterator>
+            void parallel_batch_inverse(RandomAccessIterator first, RandomAccessIterator last) {
+                const std::size_t n = std::distance(first, last);
+                const std::size_t chunks = detail::grand_product_chunks(n);
+
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static, 1)
+#endif
+                for (std::size_t c = 0; c < chunks; ++c) {
+                    batch_inverse(first + n * c / chunks, first + n * (c + 1) / chunks);
+                }
+            }
+
+            /**
+             * Replaces [first, last) with its inclusive prefix products, x_i -> x_0 * ... * x_i.
+             *
+             * Each thread scans its own chunk, then the chunk totals are scanned and every chunk but the
+             * first is multiplied by the product of the chunks before it.
+             */
+            template<typename RandomAccessIterator>
+            void parallel_prefix_product(RandomAccessIterator first, RandomAccessIterator last) {
+                typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+
+                const std::size_t n = std::distance(first, last);
+                const std::size_t chunks = detail::grand_product_chunks(n);
+
+                std::vector<value_type> totals(chunks);
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static, 1)
+#endif
+                for (std::size_t c = 0; c < chunks; ++c) {
+                    const std::size_t begin = n * c / chunks, end = n * (c + 1) / chunks;
+                    for (std::size_t i = begin + 1; i < end; ++i) {
+                        first[i] *= first[i - 1];
+                    }
+                    totals[c] = end > begin ? first[end - 1] : value_type::one();
+                }
+
+                for (std::size_t c = 1; c < chunks; ++c) {
+                    totals[c] *= totals[c - 1];
+                }
+
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static, 1)
+#endif
+                for (std::size_t c = 1; c < chunks; ++c) {
+                    const std::size_t begin = n * c / chunks, end = n * (c + 1) / chunks;
+                    for (std::size_t i = begin; i < end; ++i) {
+                        first[i] *= totals[c - 1];
+                    }
+                }
+            }
+
+            /**
+             * Grand product of the row ratios of a permutation-like argument:
+             * result[0] = 1, result[i + 1] = result[i] * numerators[i] / denominators[i].
+             *
+             * The denominators are batch inverted and the running product is a prefix scan, so the whole
+             * computation takes one field inversion per thread instead of one per row.
+             *
+             * @return numerators.size() + 1 values
+             */
+            template<typename ValueType>
+            std::vector<ValueType> grand_product(const std::vector<ValueType> &numerators,
+                                                 std::vector<ValueType> denominators) {
+                BOOST_ASSERT(numerators.size() == denominators.size());
+
+                const std::size_t n = numerators.size();
+                parallel_batch_inverse(denominators.begin(), denominators.end());
+
+                std::vector<ValueType> result(n + 1);
+                result[0] = ValueType::one();
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                for (std::size_t i = 0; i < n; ++i) {
+                    result[i + 1] = numerators[i] * denominators[i];
+                }
+                parallel_prefix_product(result.begin() + 1, result.end());
+
+                return result;
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_GRAND_PRODUCT_HPP
@@ -26,6 +26,11 @@
 #ifndef CRYPTO3_MATH_MAKE_EVALUATION_DOMAIN_HPP
 #define CRYPTO3_MATH_MAKE_EVALUATION_DOMAIN_HPP
 
+#include <list>
+#include <memory>
+#include <mutex>
+#include <utility>
+
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/domains/arithmetic_sequence_domain.hpp>
 #include <nil/crypto3/math/domains/basic_radix2_domain.hpp>
@@ -105,6 +110,103 @@ namespace nil {
 
                 return result_type();
             }
+
+            /*!
+            @brief
+             Domains made by make_evaluation_domain, created once per size and shared by all the users of
+             the cache, so their twiddle factors are computed once. Holds at most capacity sizes, the least
+             recently used one is dropped first. A dropped domain lives on while someone still holds it.
+             With capacity 0 nothing is kept and every call makes a new domain.
+             Domains are shared, so they must not be modified by the users.
+            */
+            template<typename FieldType, typename ValueType = typename FieldType::value_type>
+            class evaluation_domain_cache {
+            public:
+                typedef std::shared_ptr<evaluation_domain<FieldType, ValueType>> domain_ptr_type;
+
+                constexpr static const std::size_t default_capacity = 32;
+
+                explicit evaluation_domain_cache(std::size_t capacity = default_capacity) : capacity(capacity) {
+                }
+
+                domain_ptr_type get(std::size_t m) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    for (auto it = domains.begin(); it != domains.end(); ++it) {
+                        if (it->first == m) {
+                            domains.splice(domains.begin(), domains, it);
+                            return domains.front().second;
+                        }
+                    }
+
+                    if (capacity == 0) {
+                        return make_evaluation_domain<FieldType, ValueType>(m);
+                    }
+                    domains.emplace_front(m, make_evaluation_domain<FieldType, ValueType>(m));
+                    if (domains.size() > capacity) {
+                        domains.pop_back();
+                    }
+                    return domains.front().second;
+                }
+
+                void clear() {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    domains.clear();
+                }
+
+                /*!
+                @brief
+                 Changes the number of kept sizes, the least recently used ones beyond it are dropped.
+                 0 turns the caching off.
+                */
+                void set_capacity(std::size_t new_capacity) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    capacity = new_capacity;
+                    while (domains.size() > capacity) {
+                        domains.pop_back();
+                    }
+                }
+
+                std::size_t get_capacity() const {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    return capacity;
+                }
+
+                std::size_t size() const {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    return domains.size();
+                }
+
+            private:
+                std::size_t capacity;
+                mutable std::mutex mutex;
+                // most recently used first
+                std::list<std::pair<std::size_t, domain_ptr_type>> domains;
+            };
+
+            /*!
+            @brief
+             The cache used by get_cached_evaluation_domain when no cache is passed, one per field and value
+             type. Call clear() on it to release the domains and set_capacity() to resize it, capacity 0 turns
+             the sharing off. Callers wanting their own lifetime pass their own evaluation_domain_cache.
+            */
+            template<typename FieldType, typename ValueType = typename FieldType::value_type>
+            evaluation_domain_cache<FieldType, ValueType> &default_evaluation_domain_cache() {
+                static evaluation_domain_cache<FieldType, ValueType> cache;
+                return cache;
+            }
+
+            /*!
+            @brief
+             Same as make_evaluation_domain, but the domain is taken from the given cache, by default from
+             default_evaluation_domain_cache.
+            */
+            template<typename FieldType, typename ValueType = typename FieldType::value_type>
+            std::shared_ptr<evaluation_domain<FieldType, ValueType>> get_cached_evaluation_domain(
+                std::size_t m,
+                evaluation_domain_cache<FieldType, ValueType> &cache =
+                    default_evaluation_domain_cache<FieldType, ValueType>()) {
+                return cache.get(m);
+            }
         }    // namespace math
     }        // namespace crypto3
 }    // namespace nil
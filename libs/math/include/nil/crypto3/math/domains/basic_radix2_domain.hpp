@@ -48,24 +48,19 @@ namespace nil {
             class basic_radix2_domain : public evaluation_domain<FieldType, ValueType> {
                 typedef typename FieldType::value_type field_value_type;
                 typedef ValueType value_type;
-                typedef std::pair<std::vector<field_value_type>, std::vector<field_value_type>> cache_type;
-                std::shared_ptr<cache_type> fft_cache;
-
-                void create_fft_cache() {
-                    fft_cache = std::make_shared<cache_type>(std::vector<field_value_type>(),
-                                                             std::vector<field_value_type>());
-                    detail::create_fft_cache<FieldType>(this->m, omega, fft_cache->first);
-                    detail::create_fft_cache<FieldType>(this->m, omega.inversed(), fft_cache->second);
-                }
-
             public:
                 typedef FieldType field_type;
 
                 field_value_type omega;
 
+            private:
+                detail::lazy_fft_cache<FieldType> fft_cache;
+
+            public:
                 basic_radix2_domain(const std::size_t m)
                         : evaluation_domain<FieldType, ValueType>(m),
-                          omega(unity_root<FieldType>(m)) {
+                          omega(unity_root<FieldType>(m)),
+                          fft_cache(m, omega) {
                     if (m <= 1)
                         throw std::invalid_argument("basic_radix2(): expected m > 1");
 
@@ -86,10 +81,7 @@ namespace nil {
                         }
                     }
 
-                    if (!fft_cache) {
-                        create_fft_cache();
-                    }
-                    detail::basic_radix2_fft_cached<FieldType>(a, fft_cache->first);
+                    detail::basic_radix2_fft_dispatch<FieldType>(a, fft_cache.forward());
                 }
 
                 void inverse_fft(std::vector<value_type> &a) override {
@@ -101,12 +93,12 @@ namespace nil {
                         }
                     }
 
-                    if (!fft_cache) {
-                        create_fft_cache();
-                    }
-                    detail::basic_radix2_fft_cached<FieldType>(a, fft_cache->second);
+                    detail::basic_radix2_fft_dispatch<FieldType>(a, fft_cache.inverse());
 
                     const field_value_type sconst = field_value_type(a.size()).inversed();
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
                     for (std::size_t i = 0; i < a.size(); ++i) {
                         a[i] = a[i] * sconst;
                     }
@@ -28,11 +28,18 @@
 #define CRYPTO3_MATH_BASIC_RADIX2_DOMAIN_AUX_HPP
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
+#include <utility>
 #include <vector>
 
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
 #include <nil/crypto3/algebra/type_traits.hpp>
 
+#include <nil/crypto3/math/algorithms/batch_inverse.hpp>
 #include <nil/crypto3/math/algorithms/unity_root.hpp>
 #include <nil/crypto3/math/detail/field_utils.hpp>
 
@@ -57,6 +64,67 @@ namespace nil {
                     }
                 }
 
+                /*
+                 * Forward and inverse twiddle factors of a radix-2 transform of the given size. The tables are
+                 * built on the first use and never change after that, so a domain can be used from several
+                 * threads simultaneously. Copies share the tables instead of rebuilding them.
+                 */
+                template<typename FieldType>
+                class lazy_fft_cache {
+                public:
+                    typedef typename FieldType::value_type value_type;
+                    typedef std::pair<std::vector<value_type>, std::vector<value_type>> cache_type;
+
+                    lazy_fft_cache(const std::size_t size, const value_type &omega) : size(size), omega(omega) {
+                    }
+
+                    lazy_fft_cache(const lazy_fft_cache &other) :
+                            size(other.size), omega(other.omega), cache(std::atomic_load(&other.cache)) {
+                    }
+
+                    lazy_fft_cache &operator=(const lazy_fft_cache &other) {
+                        size = other.size;
+                        omega = other.omega;
+                        std::atomic_store(&cache, std::atomic_load(&other.cache));
+                        return *this;
+                    }
+
+                    /*
+                     * Powers omega^0, ..., omega^(size - 1).
+                     */
+                    const std::vector<value_type> &forward() const {
+                        return get().first;
+                    }
+
+                    /*
+                     * Powers omega^0, ..., omega^-(size - 1).
+                     */
+                    const std::vector<value_type> &inverse() const {
+                        return get().second;
+                    }
+
+                private:
+                    const cache_type &get() const {
+                        std::shared_ptr<const cache_type> current = std::atomic_load(&cache);
+                        if (!current) {
+                            auto built = std::make_shared<cache_type>();
+                            create_fft_cache<FieldType>(size, omega, built->first);
+                            create_fft_cache<FieldType>(size, omega.inversed(), built->second);
+                            // If another thread has published its tables first, ours are dropped.
+                            if (std::atomic_compare_exchange_strong(
+                                    &cache, &current, std::shared_ptr<const cache_type>(std::move(built)))) {
+                                current = std::atomic_load(&cache);
+                            }
+                        }
+                        // The tables are replaced only by an assignment, so the reference stays valid until then.
+                        return *current;
+                    }
+
+                    std::size_t size;
+                    value_type omega;
+                    mutable std::shared_ptr<const cache_type> cache;
+                };
+
                 /*
                  * Below we make use of pseudocode from [CLRS 2n Ed, pp. 864].
                  * Also, note that it's the caller's responsibility to multiply by 1/N.
@@ -97,6 +165,212 @@ namespace nil {
                     }
                 }
 
+                /*
+                 * Minimal transform size for which the layer-parallel FFT below spawns threads,
+                 * smaller transforms are dominated by the synchronization cost.
+                 */
+                constexpr std::size_t parallel_fft_min_size = 1u << 10;
+
+                /*
+                 * Layer-parallel version of basic_radix2_fft_cached. The bit-reverse permutation touches
+                 * disjoint pairs of elements and each stage consists of n/2 independent butterflies, so both
+                 * are split across threads with a barrier between the stages only. The output is identical
+                 * to the one of basic_radix2_fft_cached.
+                 * threads == 0 stands for omp_get_max_threads(), to override it set OMP_NUM_THREADS env var,
+                 * call omp_set_num_threads() or pass the value explicitly.
+                 * Without MULTICORE defined it is executed sequentially.
+                 * Also, note that it's the caller's responsibility to multiply by 1/N.
+                 */
+                template<typename FieldType, typename Range>
+                void basic_radix2_fft_cached_parallel(Range &a,
+                                                      const std::vector<typename FieldType::value_type> &omega_cache,
+                                                      std::size_t threads = 0) {
+                    typedef typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type
+                        value_type;
+                    BOOST_STATIC_ASSERT(algebra::is_field<FieldType>::value);
+
+                    const std::size_t n = a.size(), logn = log2(n);
+                    if (n != (1u << logn))
+                        throw std::invalid_argument("expected n == (1u << logn)");
+
+                    const std::size_t half_n = n >> 1;
+#ifdef MULTICORE
+                    const int num_threads = threads == 0 ? omp_get_max_threads() : static_cast<int>(threads);
+#else
+                    (void)threads;
+#endif
+
+#ifdef MULTICORE
+#pragma omp parallel num_threads(num_threads) if (n >= parallel_fft_min_size)
+#endif
+                    {
+#ifdef MULTICORE
+#pragma omp for schedule(static)
+#endif
+                        for (std::size_t k = 0; k < n; ++k) {
+                            const std::size_t rk = bitreverse(k, logn);
+                            if (k < rk)
+                                std::swap(a[k], a[rk]);
+                        }
+
+                        value_type t;
+                        for (std::size_t s = 1, m = 1, inc = n / 2; s <= logn; ++s, m <<= 1, inc >>= 1) {
+                            // butterfly b operates on a[k + j] and a[k + j + m], where k = 2m * (b / m), j = b % m
+#ifdef MULTICORE
+#pragma omp for schedule(static)
+#endif
+                            for (std::size_t b = 0; b < half_n; ++b) {
+                                const std::size_t j = b & (m - 1);
+                                const std::size_t k = (b - j) << 1;
+                                t = a[k + j + m];
+                                t *= omega_cache[j * inc];
+                                a[k + j + m] = a[k + j];
+                                a[k + j + m] -= t;
+                                a[k + j] += t;
+                            }
+                        }
+                    }
+                }
+
+                /*
+                 * Minimal transform size for which basic_radix2_fft_dispatch switches to the four-step FFT when
+                 * it runs on more than one thread. The four-step FFT needs a second buffer of the transform
+                 * size, and for a 255-bit field on a single core it is slower than the iterative FFT up to
+                 * 2^19 elements and 2-10% faster from 2^20 on, see math/test/benchmarks/fft_benchmark.cpp.
+                 */
+                constexpr std::size_t four_step_fft_min_size = 1u << 20;
+
+                /*
+                 * Number of adjacent columns gathered at once by the four-step FFT, so that every cache line
+                 * read while transposing is used completely.
+                 */
+                constexpr std::size_t four_step_fft_block_size = 16;
+
+                /*
+                 * Bailey's four-step FFT. The input of size n = n1 * n2 is considered as an n2 x n1 row-major
+                 * matrix, then:
+                 *  1) n1 FFTs of size n2 are computed over the columns,
+                 *  2) the element (j1, k2) of the result is multiplied by omega^(j1 * k2),
+                 *  3) n2 FFTs of size n1 are computed over the rows of the transposed matrix,
+                 *  4) the result is transposed back, so the output is in the natural order.
+                 * Sub-FFTs are small enough to stay cache-resident, which makes the transform faster than
+                 * basic_radix2_fft_cached for vectors that do not fit into cache. The output is identical
+                 * to the one of basic_radix2_fft_cached. omega_cache should contain n powers of omega.
+                 * Sub-FFTs are split across threads if MULTICORE is defined, threads == 0 stands for
+                 * omp_get_max_threads().
+                 * Also, note that it's the caller's responsibility to multiply by 1/N.
+                 */
+                template<typename FieldType, typename Range>
+                void basic_radix2_fft_four_step(Range &a,
+                                                const std::vector<typename FieldType::value_type> &omega_cache,
+                                                std::size_t threads = 0) {
+                    typedef typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type
+                        value_type;
+                    typedef typename FieldType::value_type field_value_type;
+                    BOOST_STATIC_ASSERT(algebra::is_field<FieldType>::value);
+
+                    const std::size_t n = a.size(), logn = log2(n);
+                    if (n != (1u << logn))
+                        throw std::invalid_argument("expected n == (1u << logn)");
+                    if (omega_cache.size() < n)
+                        throw std::invalid_argument("expected omega_cache.size() >= n");
+
+                    if (n < 4) {
+                        basic_radix2_fft_cached<FieldType>(a, omega_cache);
+                        return;
+                    }
+
+                    const std::size_t n1 = 1u << (logn / 2), n2 = n / n1;
+                    const std::size_t block_size = std::min(four_step_fft_block_size, n1);
+
+                    std::vector<field_value_type> n1_omega_cache(n1), n2_omega_cache(n2);
+                    for (std::size_t i = 0; i < n1; ++i) {
+                        n1_omega_cache[i] = omega_cache[i * n2];
+                    }
+                    for (std::size_t i = 0; i < n2; ++i) {
+                        n2_omega_cache[i] = omega_cache[i * n1];
+                    }
+
+                    std::vector<value_type> tmp(n);
+#ifdef MULTICORE
+                    const int num_threads = threads == 0 ? omp_get_max_threads() : static_cast<int>(threads);
+#else
+                    (void)threads;
+#endif
+
+                    // columns j1 of the n2 x n1 input become rows of the n1 x n2 tmp
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+#endif
+                    for (std::size_t block_start = 0; block_start < n1; block_start += block_size) {
+                        std::vector<std::vector<value_type>> columns(block_size, std::vector<value_type>(n2));
+                        for (std::size_t j2 = 0; j2 < n2; ++j2) {
+                            for (std::size_t c = 0; c < block_size; ++c) {
+                                columns[c][j2] = a[j2 * n1 + block_start + c];
+                            }
+                        }
+                        for (std::size_t c = 0; c < block_size; ++c) {
+                            const std::size_t j1 = block_start + c;
+                            basic_radix2_fft_cached<FieldType>(columns[c], n2_omega_cache);
+                            for (std::size_t k2 = 0, idx = 0; k2 < n2; ++k2, idx = (idx + j1) & (n - 1)) {
+                                columns[c][k2] *= omega_cache[idx];
+                            }
+                            std::copy(columns[c].begin(), columns[c].end(), tmp.begin() + j1 * n2);
+                        }
+                    }
+
+                    // columns k2 of the n1 x n2 tmp are transformed and written back as columns of n1 x n2 output
+                    const std::size_t rows_block_size = std::min(four_step_fft_block_size, n2);
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+#endif
+                    for (std::size_t block_start = 0; block_start < n2; block_start += rows_block_size) {
+                        std::vector<std::vector<value_type>> rows(rows_block_size, std::vector<value_type>(n1));
+                        for (std::size_t j1 = 0; j1 < n1; ++j1) {
+                            for (std::size_t c = 0; c < rows_block_size; ++c) {
+                                rows[c][j1] = tmp[j1 * n2 + block_start + c];
+                            }
+                        }
+                        for (std::size_t c = 0; c < rows_block_size; ++c) {
+                            basic_radix2_fft_cached<FieldType>(rows[c], n1_omega_cache);
+                        }
+                        for (std::size_t k1 = 0; k1 < n1; ++k1) {
+                            for (std::size_t c = 0; c < rows_block_size; ++c) {
+                                a[k1 * n2 + block_start + c] = rows[c][k1];
+                            }
+                        }
+                    }
+                }
+
+                /*
+                 * Chooses the fastest of the transforms above for the size of a. The radix-2 FFT is the
+                 * default, the four-step one is used only for transforms of at least four_step_fft_min_size
+                 * elements running on more than one thread.
+                 * threads == 1 forces the sequential execution, see basic_radix2_fft_cached_parallel.
+                 * omega_cache should contain a.size() powers of omega.
+                 * Also, note that it's the caller's responsibility to multiply by 1/N.
+                 */
+                template<typename FieldType, typename Range>
+                void basic_radix2_fft_dispatch(Range &a,
+                                               const std::vector<typename FieldType::value_type> &omega_cache,
+                                               std::size_t threads = 0) {
+#ifdef MULTICORE
+                    if (threads != 1) {
+                        const std::size_t num_threads =
+                            threads == 0 ? static_cast<std::size_t>(omp_get_max_threads()) : threads;
+                        if (num_threads > 1 && a.size() >= four_step_fft_min_size) {
+                            basic_radix2_fft_four_step<FieldType>(a, omega_cache, threads);
+                        } else {
+                            basic_radix2_fft_cached_parallel<FieldType>(a, omega_cache, threads);
+                        }
+                        return;
+                    }
+#else
+                    (void)threads;
+#endif
+                    basic_radix2_fft_cached<FieldType>(a, omega_cache);
+                }
+
                 /**
                  * Note that it's the caller's responsibility to multiply by 1/N.
                  */
@@ -166,10 +440,14 @@ namespace nil {
                     value_type l = Z * value_type(m).inversed();
                     value_type r = value_type::one();
                     for (std::size_t i = 0; i < m; ++i) {
-                        u[i] = l * (t - r).inversed();
-                        l *= omega;
+                        u[i] = t - r;
                         r *= omega;
                     }
+                    batch_inverse(u);
+                    for (std::size_t i = 0; i < m; ++i) {
+                        u[i] *= l;
+                        l *= omega;
+                    }
 
                     return u;
                 }
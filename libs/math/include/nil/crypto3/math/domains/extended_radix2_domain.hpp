@@ -47,16 +47,6 @@ namespace nil {
             class extended_radix2_domain : public evaluation_domain<FieldType, ValueType> {
                 typedef typename FieldType::value_type field_value_type;
                 typedef ValueType value_type;
-                typedef std::pair<std::vector<field_value_type>, std::vector<field_value_type>> cache_type;
-
-                std::unique_ptr<cache_type> fft_cache;
-
-                void create_fft_cache() {
-                    fft_cache = std::make_unique<cache_type>(std::vector<field_value_type>(),
-                                                             std::vector<field_value_type>());
-                    detail::create_fft_cache<FieldType>(small_m, omega, fft_cache->first);
-                    detail::create_fft_cache<FieldType>(small_m, omega.inversed(), fft_cache->second);
-                }
             public:
                 typedef FieldType field_type;
 
@@ -64,11 +54,16 @@ namespace nil {
                 const field_value_type omega;
                 const field_value_type shift;
 
+            private:
+                detail::lazy_fft_cache<FieldType> fft_cache;
+
+            public:
                 extended_radix2_domain(const std::size_t m)
                         : evaluation_domain<FieldType, ValueType>(m),
                           small_m(m / 2),
                           omega(unity_root<FieldType>(small_m)),
-                          shift(detail::coset_shift<FieldType>()) {
+                          shift(detail::coset_shift<FieldType>()),
+                          fft_cache(small_m, omega) {
                     if (m <= 1)
                         throw std::invalid_argument("extended_radix2(): expected m > 1");
 
@@ -102,11 +97,8 @@ namespace nil {
                         shift_i *= shift;
                     }
 
-                    if (fft_cache == nullptr) {
-                        create_fft_cache();
-                    }
-                    detail::basic_radix2_fft_cached<FieldType>(a0, fft_cache->first);
-                    detail::basic_radix2_fft_cached<FieldType>(a1, fft_cache->first);
+                    detail::basic_radix2_fft_dispatch<FieldType>(a0, fft_cache.forward());
+                    detail::basic_radix2_fft_dispatch<FieldType>(a1, fft_cache.forward());
 
                     for (std::size_t i = 0; i < small_m; ++i) {
                         a[i] = a0[i];
@@ -127,11 +119,8 @@ namespace nil {
                     std::vector<value_type> a0(a.begin(), a.begin() + small_m);
                     std::vector<value_type> a1(a.begin() + small_m, a.end());
 
-                    if (fft_cache == nullptr) {
-                        create_fft_cache();
-                    }
-                    detail::basic_radix2_fft_cached<FieldType>(a0, fft_cache->second);
-                    detail::basic_radix2_fft_cached<FieldType>(a1, fft_cache->second);
+                    detail::basic_radix2_fft_dispatch<FieldType>(a0, fft_cache.inverse());
+                    detail::basic_radix2_fft_dispatch<FieldType>(a1, fft_cache.inverse());
 
                     const field_value_type shift_to_small_m = shift.pow(small_m);
                     const field_value_type sconst = (field_value_type(small_m) * (field_value_type::one() - shift_to_small_m)).inversed();
@@ -31,6 +31,7 @@
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/domains/basic_radix2_domain.hpp>
 #include <nil/crypto3/math/domains/detail/basic_radix2_domain_aux.hpp>
+#include <nil/crypto3/math/algorithms/batch_inverse.hpp>
 #include <nil/crypto3/math/algorithms/unity_root.hpp>
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 
@@ -47,20 +48,6 @@ namespace nil {
             class step_radix2_domain : public evaluation_domain<FieldType, ValueType> {
                 typedef typename FieldType::value_type field_value_type;
                 typedef ValueType value_type;
-                typedef std::pair<std::vector<field_value_type>, std::vector<field_value_type>> cache_type;
-
-                std::unique_ptr<cache_type> small_fft_cache, big_fft_cache;
-
-                void create_fft_cache() {
-                    small_fft_cache = std::make_unique<cache_type>(
-                        std::make_pair(std::vector<field_value_type>(), std::vector<field_value_type>()));
-                    big_fft_cache = std::make_unique<cache_type>(
-                        std::make_pair(std::vector<field_value_type>(), std::vector<field_value_type>()));
-                    detail::create_fft_cache<FieldType>(big_m, big_omega, big_fft_cache->first);
-                    detail::create_fft_cache<FieldType>(big_m, big_omega.inversed(), big_fft_cache->second);
-                    detail::create_fft_cache<FieldType>(small_m, small_omega, small_fft_cache->first);
-                    detail::create_fft_cache<FieldType>(small_m, small_omega.inversed(), small_fft_cache->second);
-                }
             public:
                 typedef FieldType field_type;
 
@@ -70,13 +57,19 @@ namespace nil {
                 const field_value_type big_omega;
                 const field_value_type small_omega;
 
+            private:
+                detail::lazy_fft_cache<FieldType> small_fft_cache, big_fft_cache;
+
+            public:
                 step_radix2_domain(const std::size_t m)
                         : evaluation_domain<FieldType, ValueType>(m),
                           big_m(1ul << (static_cast<std::size_t>(std::ceil(std::log2(m))) - 1)),
                           small_m(m - big_m),
                           omega(unity_root<FieldType>(1ul << static_cast<std::size_t>(std::ceil(std::log2(m))))),
                           big_omega(omega.squared()),
-                          small_omega(unity_root<FieldType>(small_m)) {
+                          small_omega(unity_root<FieldType>(small_m)),
+                          small_fft_cache(small_m, small_omega),
+                          big_fft_cache(big_m, big_omega) {
                     if (m <= 1)
                         throw std::invalid_argument("step_radix2(): expected m > 1");
 
@@ -112,11 +105,8 @@ namespace nil {
                         }
                     }
 
-                    if (small_fft_cache == nullptr) {
-                        create_fft_cache();
-                    }
-                    detail::basic_radix2_fft_cached<FieldType>(c, big_fft_cache->first);
-                    detail::basic_radix2_fft_cached<FieldType>(e, small_fft_cache->first);
+                    detail::basic_radix2_fft_cached<FieldType>(c, big_fft_cache.forward());
+                    detail::basic_radix2_fft_cached<FieldType>(e, small_fft_cache.forward());
 
                     for (std::size_t i = 0; i < big_m; ++i) {
                         a[i] = c[i];
@@ -133,11 +123,8 @@ namespace nil {
                     std::vector<value_type> U0(a.begin(), a.begin() + big_m);
                     std::vector<value_type> U1(a.begin() + big_m, a.end());
 
-                    if (small_fft_cache == nullptr) {
-                        create_fft_cache();
-                    }
-                    detail::basic_radix2_fft_cached<FieldType>(U0, big_fft_cache->second);
-                    detail::basic_radix2_fft_cached<FieldType>(U1, small_fft_cache->second);
+                    detail::basic_radix2_fft_cached<FieldType>(U0, big_fft_cache.inverse());
+                    detail::basic_radix2_fft_cached<FieldType>(U1, small_fft_cache.inverse());
 
                     const field_value_type U0_size_inv = field_value_type(big_m).inversed();
                     for (std::size_t i = 0; i < big_m; ++i) {
@@ -200,11 +187,16 @@ namespace nil {
                     const field_value_type L0 = t.pow(small_m) - omega.pow(small_m);
                     const field_value_type omega_to_small_m = omega.pow(small_m);
                     const field_value_type big_omega_to_small_m = big_omega.pow(small_m);
+                    std::vector<field_value_type> denominators(big_m);
                     field_value_type elt = field_value_type::one();
                     for (std::size_t i = 0; i < big_m; ++i) {
-                        result[i] = inner_big[i] * L0 * (elt - omega_to_small_m).inversed();
+                        denominators[i] = elt - omega_to_small_m;
                         elt *= big_omega_to_small_m;
                     }
+                    batch_inverse(denominators);
+                    for (std::size_t i = 0; i < big_m; ++i) {
+                        result[i] = inner_big[i] * L0 * denominators[i];
+                    }
 
                     const field_value_type L1 =
                         (t.pow(big_m) - field_value_type::one()) * (omega.pow(big_m) - field_value_type::one()).inversed();
@@ -247,11 +239,16 @@ namespace nil {
 
                     const field_value_type omega_to_small_m = omega.pow(small_m);
                     const field_value_type big_omega_to_small_m = big_omega.pow(small_m);
+                    std::vector<field_value_type> denominators(big_m);
                     field_value_type elt = field_value_type::one();
                     for (std::size_t i = 0; i < big_m; ++i) {
-                        result[i] = (inner_big_times_t_to_small_m[i] - inner_big[i] * omega_to_small_m) * (elt - omega_to_small_m).inversed();
+                        denominators[i] = elt - omega_to_small_m;
                         elt *= big_omega_to_small_m;
                     }
+                    batch_inverse(denominators);
+                    for (std::size_t i = 0; i < big_m; ++i) {
+                        result[i] = (inner_big_times_t_to_small_m[i] - inner_big[i] * omega_to_small_m) * denominators[i];
+                    }
 
                     const field_value_type one_over_small_denom = (omega.pow(big_m) - field_value_type::one()).inversed();
 
@@ -308,12 +305,17 @@ namespace nil {
                     const field_value_type coset_to_small_m_times_Z0 = coset.pow(small_m) * Z0;
                     const field_value_type omega_to_small_m_times_Z0 = omega.pow(small_m) * Z0;
                     const field_value_type omega_to_2small_m = omega.pow(2 * small_m);
+                    std::vector<field_value_type> denominators(big_m);
                     field_value_type elt = field_value_type::one();
 
                     for (std::size_t i = 0; i < big_m; ++i) {
-                        P[i] *= (coset_to_small_m_times_Z0 * elt - omega_to_small_m_times_Z0).inversed();
+                        denominators[i] = coset_to_small_m_times_Z0 * elt - omega_to_small_m_times_Z0;
                         elt *= omega_to_2small_m;
                     }
+                    batch_inverse(denominators);
+                    for (std::size_t i = 0; i < big_m; ++i) {
+                        P[i] *= denominators[i];
+                    }
 
                     // (c^{2^k}*w^{2^k}-1) * (c^{2^k} * w^{2^r} - w^{2^r})
 
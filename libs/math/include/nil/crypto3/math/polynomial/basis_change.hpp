@@ -29,6 +29,7 @@
 #include <algorithm>
 #include <vector>
 
+#include <nil/crypto3/math/algorithms/batch_inverse.hpp>
 #include <nil/crypto3/math/polynomial/basic_operations.hpp>
 #include <nil/crypto3/math/polynomial/xgcd.hpp>
 
@@ -202,10 +203,23 @@ namespace nil {
                 z[0] = field_value_type::one();
                 f[0] = a[0];
 
+                std::vector<field_value_type> inversed_terms(n, field_value_type::one());
+                std::vector<field_value_type> inversed_triangular(n, field_value_type::one());
                 for (std::size_t i = 1; i < n; i++) {
-                    u[i] = u[i - 1] * geometric_sequence[i] * (field_value_type::one() - geometric_sequence[i]).inversed();
-                    w[i] = a[i] * (u[i].inversed());
-                    z[i] = u[i] * geometric_triangular_sequence[i].inversed();
+                    inversed_terms[i] = field_value_type::one() - geometric_sequence[i];
+                    inversed_triangular[i] = geometric_triangular_sequence[i];
+                }
+                batch_inverse(inversed_terms);
+                batch_inverse(inversed_triangular);
+
+                for (std::size_t i = 1; i < n; i++) {
+                    u[i] = u[i - 1] * geometric_sequence[i] * inversed_terms[i];
+                }
+                std::vector<field_value_type> inversed_u = batch_inversed(u);
+
+                for (std::size_t i = 1; i < n; i++) {
+                    w[i] = a[i] * inversed_u[i];
+                    z[i] = u[i] * inversed_triangular[i];
                     f[i] = w[i] * geometric_triangular_sequence[i];
 
                     if (i % 2 == 1) {
@@ -244,15 +258,28 @@ namespace nil {
                 w[0] = a[0];
                 z[0] = field_value_type::one();
 
+                std::vector<field_value_type> inversed_terms(n, field_value_type::one());
+                std::vector<field_value_type> inversed_triangular(n, field_value_type::one());
+                for (std::size_t i = 1; i < n; i++) {
+                    inversed_terms[i] = field_value_type::one() - geometric_sequence[i];
+                    inversed_triangular[i] = geometric_triangular_sequence[i];
+                }
+                batch_inverse(inversed_terms);
+                batch_inverse(inversed_triangular);
+
+                for (std::size_t i = 1; i < n; i++) {
+                    u[i] = u[i - 1] * geometric_sequence[i] * inversed_terms[i];
+                }
+                std::vector<field_value_type> inversed_u = batch_inversed(u);
+
                 for (std::size_t i = 1; i < n; i++) {
                     v[i] = a[i] * geometric_triangular_sequence[i];
                     if (i % 2 == 1)
                         v[i] = -v[i];
 
-                    u[i] = u[i - 1] * geometric_sequence[i] * (field_value_type::one() - geometric_sequence[i]).inversed();
-                    w[i] = v[i] * u[i].inversed();
+                    w[i] = v[i] * inversed_u[i];
 
-                    z[i] = u[i] * geometric_triangular_sequence[i].inversed();
+                    z[i] = u[i] * inversed_triangular[i];
                     if (i % 2 == 1)
                         z[i] = -z[i];
                 }
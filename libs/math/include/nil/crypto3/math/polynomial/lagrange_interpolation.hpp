@@ -27,6 +27,9 @@
 #ifndef CRYPTO3_MATH_LAGRANGE_INTERPOLATION_HPP
 #define CRYPTO3_MATH_LAGRANGE_INTERPOLATION_HPP
 
+#include <vector>
+
+#include <nil/crypto3/math/algorithms/batch_inverse.hpp>
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
@@ -47,13 +50,23 @@ namespace nil {
 
                 std::size_t k = std::size(points);
 
+                // Denominators prod_{m != j} (x_j - x_m) of all the basis polynomials are inverted at once.
+                std::vector<FieldValueType> denominators(k, FieldValueType::one());
+                for (std::size_t j = 0; j < k; ++j) {
+                    for (std::size_t m = 0; m < k; ++m) {
+                        if (m != j) {
+                            denominators[j] *= points[j].first - points[m].first;
+                        }
+                    }
+                }
+                batch_inverse(denominators);
+
                 polynomial<FieldValueType> result;
                 for (std::size_t j = 0; j < k; ++j) {
-                    polynomial<FieldValueType> term({points[j].second});
+                    polynomial<FieldValueType> term({points[j].second * denominators[j]});
                     for (std::size_t m = 0; m < k; ++m) {
                         if (m != j) {
-                            term = term * (polynomial<FieldValueType>({-points[m].first, FieldValueType::one()}) *
-                                           (points[j].first - points[m].first).inversed());
+                            term = term * polynomial<FieldValueType>({-points[m].first, FieldValueType::one()});
                         }
                     }
                     result = result + term;
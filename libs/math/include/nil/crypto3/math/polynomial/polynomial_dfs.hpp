@@ -37,6 +37,8 @@
 
 #include <boost/functional/hash.hpp>
 
+#include <nil/crypto3/algebra/fields/batch_arithmetic.hpp>
+
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/polynomial/basic_operations.hpp>
@@ -51,6 +53,7 @@ namespace nil {
             template<typename FieldValueType, typename Allocator = std::allocator<FieldValueType>>
             class polynomial_dfs {
                 typedef std::vector<FieldValueType, Allocator> container_type;
+                typedef algebra::fields::batch_arithmetic<FieldValueType> batch_arithmetic_type;
 
                 container_type val;
                 size_t _d;
@@ -348,14 +351,14 @@ namespace nil {
                     } else {
                         typedef typename value_type::field_type FieldType;
                         if (old_domain == nullptr) {
-                            old_domain = make_evaluation_domain<FieldType>(this->size());
+                            old_domain = get_cached_evaluation_domain<FieldType>(this->size());
                         } else {
                             BOOST_ASSERT_MSG(old_domain->size() == this->size(), "Old domain size is not equal to the polynomial size");
                         }
                         old_domain->inverse_fft(this->val);
                         this->val.resize(_sz, FieldValueType::zero());
                         if (new_domain == nullptr) {
-                            new_domain = make_evaluation_domain<FieldType>(_sz);
+                            new_domain = get_cached_evaluation_domain<FieldType>(_sz);
                         } else {
                             BOOST_ASSERT_MSG(new_domain->size() == _sz, "New domain size is not equal to the polynomial size");
                         }
@@ -441,10 +444,10 @@ namespace nil {
                         polynomial_dfs tmp(other);
                         tmp.resize(this->size());
 
-                        std::transform(tmp.begin(), tmp.end(), this->begin(), this->begin(), std::plus<FieldValueType>());
+                        batch_arithmetic_type::add(this->data(), this->data(), tmp.data(), this->size());
                         return *this;
                     }
-                    std::transform(other.begin(), other.end(), this->begin(), this->begin(), std::plus<FieldValueType>());
+                    batch_arithmetic_type::add(this->data(), this->data(), other.data(), this->size());
                     return *this;
                 }
 
@@ -490,10 +493,10 @@ namespace nil {
                     if (this->size() > other.size()) {
                         polynomial_dfs tmp(other);
                         tmp.resize(this->size());
-                        std::transform(this->begin(), this->end(), tmp.begin(), this->begin(), std::minus<FieldValueType>());
+                        batch_arithmetic_type::sub(this->data(), this->data(), tmp.data(), this->size());
                         return *this;
                     }
-                    std::transform(this->begin(), this->end(), other.begin(), this->begin(), std::minus<FieldValueType>());
+                    batch_arithmetic_type::sub(this->data(), this->data(), other.data(), this->size());
                     return *this;
                 }
 
@@ -549,10 +552,10 @@ namespace nil {
                         polynomial_dfs tmp(other);
                         tmp.resize(polynomial_s, other_domain, new_domain);
 
-                        std::transform(tmp.begin(), tmp.end(), this->begin(), this->begin(), std::multiplies<FieldValueType>());
+                        batch_arithmetic_type::mul(this->data(), this->data(), tmp.data(), this->size());
                         return *this;
                     }
-                    std::transform(this->begin(), this->end(), other.begin(), this->begin(), std::multiplies<FieldValueType>());
+                    batch_arithmetic_type::mul(this->data(), this->data(), other.data(), this->size());
                     return *this;
                 }
 
@@ -561,7 +564,7 @@ namespace nil {
                  * and stores result in polynomial A.
                  */
                 polynomial_dfs& operator*=(const FieldValueType& alpha) {
-                    for( auto it = this->begin(); it!=this->end(); it++) *it *= alpha;
+                    batch_arithmetic_type::mul(this->data(), this->data(), alpha, this->size());
                     return *this;
                 }
 
@@ -579,9 +582,10 @@ namespace nil {
 
                     typedef typename value_type::field_type FieldType;
                     size_t n = this->size();
-                    value_type omega = unity_root<FieldType>(n);
                     q.resize(n);
-                    detail::basic_radix2_fft<FieldType>(q, omega);
+                    if (n > 1) {
+                        get_cached_evaluation_domain<FieldType>(n)->fft(q);
+                    }
                     return polynomial_dfs(new_s - 1, q);
                 }
 
@@ -599,9 +603,10 @@ namespace nil {
 
                     typedef typename value_type::field_type FieldType;
                     size_t n = this->size();
-                    value_type omega = unity_root<FieldType>(n);
                     r.resize(n);
-                    detail::basic_radix2_fft<FieldType>(r, omega);
+                    if (n > 1) {
+                        get_cached_evaluation_domain<FieldType>(n)->fft(r);
+                    }
                     return polynomial_dfs(new_s - 1, r);
                 }
 
@@ -609,27 +614,23 @@ namespace nil {
                 void from_coefficients(const ContainerType &tmp) {
                     typedef typename value_type::field_type FieldType;
                     size_t n = detail::power_of_two(tmp.size());
-                    value_type omega = unity_root<FieldType>(n);
                     _d = tmp.size() - 1;
                     val.assign(tmp.begin(), tmp.end());
                     val.resize(n, FieldValueType::zero());
-                    detail::basic_radix2_fft<FieldType>(val, omega);
+                    if (n > 1) {
+                        get_cached_evaluation_domain<FieldType>(n)->fft(val);
+                    }
                 }
 
                 std::vector<FieldValueType> coefficients(
                         std::shared_ptr<evaluation_domain<typename value_type::field_type>> domain = nullptr) const {
                     typedef typename value_type::field_type FieldType;
-                    value_type omega = unity_root<FieldType>(this->size());
                     std::vector<FieldValueType> tmp(this->begin(), this->end());
 
-                    if (domain == nullptr) {
-                        detail::basic_radix2_fft<FieldType>(tmp, omega.inversed());
-                        const value_type sconst = value_type(this->size()).inversed();
-                        std::transform(tmp.begin(),
-                                    tmp.end(),
-                                    tmp.begin(),
-                                    std::bind(std::multiplies<value_type>(), sconst, std::placeholders::_1));
-                    } else {
+                    if (domain == nullptr && this->size() > 1) {
+                        domain = get_cached_evaluation_domain<FieldType>(this->size());
+                    }
+                    if (domain != nullptr) {
                         domain->inverse_fft(tmp);
                     }
 
@@ -827,7 +828,7 @@ namespace nil {
 
                 // This loop will run in parallel.
                 for (const auto& domain_size: needed_domain_sizes) {
-                    domain_cache[domain_size] = make_evaluation_domain<FieldType>(domain_size);
+                    domain_cache[domain_size] = get_cached_evaluation_domain<FieldType>(domain_size);
                 }
 
                 for (std::size_t stride = 1; stride < multipliers.size(); stride <<= 1) {
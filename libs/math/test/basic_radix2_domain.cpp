@@ -111,6 +111,58 @@ BOOST_AUTO_TEST_CASE(basic_radix2_domain_benchmark, *boost::unit_test::disabled(
               << " ms" << std::endl;
 }
 
+BOOST_AUTO_TEST_CASE(parallel_fft_matches_sequential) {
+    using value_type = FieldType::value_type;
+    for (std::size_t log_size = 1; log_size <= 12; ++log_size) {
+        const std::size_t fft_size = 1 << log_size;
+        std::vector<value_type> sequential(fft_size);
+        for (std::size_t i = 0; i < fft_size; ++i) {
+            sequential[i] = nil::crypto3::algebra::random_element<FieldType>();
+        }
+        std::vector<value_type> parallel(sequential);
+
+        std::vector<value_type> omega_cache;
+        nil::crypto3::math::detail::create_fft_cache<FieldType>(
+            fft_size, unity_root<FieldType>(fft_size), omega_cache);
+
+        nil::crypto3::math::detail::basic_radix2_fft_cached<FieldType>(sequential, omega_cache);
+        nil::crypto3::math::detail::basic_radix2_fft_cached_parallel<FieldType>(parallel, omega_cache, 4);
+
+        BOOST_CHECK(sequential == parallel);
+    }
+
+    basic_radix2_domain<FieldType> domain(1 << 12);
+    std::vector<value_type> a(1 << 12);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        a[i] = nil::crypto3::algebra::random_element<FieldType>();
+    }
+    std::vector<value_type> b(a);
+    domain.fft(b);
+    domain.inverse_fft(b);
+    BOOST_CHECK(a == b);
+}
+
+BOOST_AUTO_TEST_CASE(four_step_fft_matches_iterative) {
+    using value_type = FieldType::value_type;
+    for (std::size_t log_size = 1; log_size <= 13; ++log_size) {
+        const std::size_t fft_size = 1 << log_size;
+        std::vector<value_type> iterative(fft_size);
+        for (std::size_t i = 0; i < fft_size; ++i) {
+            iterative[i] = nil::crypto3::algebra::random_element<FieldType>();
+        }
+        std::vector<value_type> four_step(iterative);
+
+        std::vector<value_type> omega_cache;
+        nil::crypto3::math::detail::create_fft_cache<FieldType>(
+            fft_size, unity_root<FieldType>(fft_size), omega_cache);
+
+        nil::crypto3::math::detail::basic_radix2_fft_cached<FieldType>(iterative, omega_cache);
+        nil::crypto3::math::detail::basic_radix2_fft_four_step<FieldType>(four_step, omega_cache);
+
+        BOOST_CHECK(iterative == four_step);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(fft_vs_multiplication_benchmark) {
     using value_type = FieldType::value_type;
     const std::size_t fft_size = 1 << 16;
@@ -0,0 +1,71 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE batch_inverse_test
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/math/algorithms/batch_inverse.hpp>
+
+using namespace nil::crypto3::algebra;
+using namespace nil::crypto3::math;
+
+typedef fields::bls12_fr<381> FieldType;
+
+BOOST_AUTO_TEST_SUITE(batch_inverse_test_suite)
+
+BOOST_AUTO_TEST_CASE(batch_inverse_matches_inversed) {
+    using value_type = FieldType::value_type;
+    for (std::size_t size : {1, 2, 3, 17, 256}) {
+        std::vector<value_type> values(size);
+        for (auto &x : values) {
+            x = random_element<FieldType>();
+        }
+        std::vector<value_type> inversed = batch_inversed(values);
+        for (std::size_t i = 0; i < size; ++i) {
+            BOOST_CHECK(inversed[i] == values[i].inversed());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(batch_inverse_skips_zeros) {
+    using value_type = FieldType::value_type;
+    std::vector<value_type> values = {value_type::zero(), value_type(2), value_type::zero(), value_type(5),
+                                      value_type::zero()};
+    std::vector<value_type> expected = {value_type::zero(), value_type(2).inversed(), value_type::zero(),
+                                        value_type(5).inversed(), value_type::zero()};
+    batch_inverse(values);
+    BOOST_CHECK(values == expected);
+
+    std::vector<value_type> empty;
+    batch_inverse(empty);
+    BOOST_CHECK(empty.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,81 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE batch_inverse_benchmark_test
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/math/algorithms/batch_inverse.hpp>
+#include <nil/crypto3/random/algebraic_engine.hpp>
+
+using namespace nil::crypto3::math;
+
+BOOST_AUTO_TEST_SUITE(batch_inverse_benchmark_test_suite)
+
+// Compares inverting every element separately against batch_inverse.
+BOOST_AUTO_TEST_CASE(separate_vs_batch_inverse) {
+    using FieldType = nil::crypto3::algebra::fields::bls12_fr<381>;
+    using value_type = FieldType::value_type;
+
+    const std::size_t min_log_size = 4, max_log_size = 16;
+    nil::crypto3::random::algebraic_engine<FieldType> engine(1337);
+
+    std::cout << std::setw(10) << "log2(n)" << std::setw(18) << "separate (ms)" << std::setw(18) << "batch (ms)"
+              << std::endl;
+
+    for (std::size_t log_size = min_log_size; log_size <= max_log_size; ++log_size) {
+        const std::size_t size = std::size_t(1) << log_size;
+        std::vector<value_type> input(size);
+        for (auto &x : input) {
+            x = engine();
+        }
+
+        std::vector<value_type> separate(input), batch(input);
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (auto &x : separate) {
+            x = x.inversed();
+        }
+        const double separate_time =
+            std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+        start = std::chrono::high_resolution_clock::now();
+        batch_inverse(batch);
+        const double batch_time =
+            std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+        BOOST_CHECK(separate == batch);
+        std::cout << std::setw(10) << log_size << std::fixed << std::setprecision(3) << std::setw(18)
+                  << separate_time << std::setw(18) << batch_time << std::endl;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
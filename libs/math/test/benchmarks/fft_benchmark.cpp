@@ -0,0 +1,117 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE fft_benchmark_test
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/math/algorithms/unity_root.hpp>
+#include <nil/crypto3/math/domains/detail/basic_radix2_domain_aux.hpp>
+#include <nil/crypto3/random/algebraic_engine.hpp>
+
+using namespace nil::crypto3::math;
+
+BOOST_AUTO_TEST_SUITE(fft_benchmark_test_suite)
+
+// Compares the iterative radix-2 FFT against the four-step one in order to find the size
+// from which the four-step FFT should be used, see detail::four_step_fft_min_size.
+// Both are measured on one thread and, with MULTICORE, on all the threads, where the dispatch
+// compares the four-step FFT with the layer-parallel radix-2 one.
+BOOST_AUTO_TEST_CASE(iterative_vs_four_step_fft_crossover) {
+    using FieldType = nil::crypto3::algebra::fields::bls12_fr<381>;
+    using value_type = FieldType::value_type;
+
+    const std::size_t min_log_size = 10, max_log_size = 22, repetitions = 3;
+    nil::crypto3::random::algebraic_engine<FieldType> engine(1337);
+
+#ifdef MULTICORE
+    const std::vector<std::size_t> thread_counts = {1, std::size_t(omp_get_max_threads())};
+#else
+    const std::vector<std::size_t> thread_counts = {1};
+#endif
+
+    for (std::size_t threads : thread_counts) {
+        std::cout << "threads: " << threads << std::endl;
+        std::cout << std::setw(10) << "log2(n)" << std::setw(18) << "iterative (ms)" << std::setw(18)
+                  << "four-step (ms)" << std::endl;
+
+        std::size_t crossover = 0;
+        for (std::size_t log_size = min_log_size; log_size <= max_log_size; ++log_size) {
+            const std::size_t size = std::size_t(1) << log_size;
+            std::vector<value_type> input(size);
+            for (auto &x : input) {
+                x = engine();
+            }
+            std::vector<value_type> omega_cache;
+            detail::create_fft_cache<FieldType>(size, unity_root<FieldType>(size), omega_cache);
+
+            double iterative_time = 0, four_step_time = 0;
+            for (std::size_t r = 0; r < repetitions; ++r) {
+                std::vector<value_type> iterative(input), four_step(input);
+
+                auto start = std::chrono::high_resolution_clock::now();
+                if (threads == 1) {
+                    detail::basic_radix2_fft_cached<FieldType>(iterative, omega_cache);
+                } else {
+                    detail::basic_radix2_fft_cached_parallel<FieldType>(iterative, omega_cache, threads);
+                }
+                iterative_time += std::chrono::duration<double, std::milli>(
+                    std::chrono::high_resolution_clock::now() - start).count();
+
+                start = std::chrono::high_resolution_clock::now();
+                detail::basic_radix2_fft_four_step<FieldType>(four_step, omega_cache, threads);
+                four_step_time += std::chrono::duration<double, std::milli>(
+                    std::chrono::high_resolution_clock::now() - start).count();
+
+                BOOST_CHECK(iterative == four_step);
+            }
+            iterative_time /= repetitions;
+            four_step_time /= repetitions;
+
+            if (crossover == 0 && four_step_time < iterative_time) {
+                crossover = log_size;
+            }
+            std::cout << std::setw(10) << log_size << std::fixed << std::setprecision(3) << std::setw(18)
+                      << iterative_time << std::setw(18) << four_step_time << std::endl;
+        }
+
+        if (crossover != 0) {
+            std::cout << "Four-step FFT is faster starting from n = 2^" << crossover << std::endl;
+        } else {
+            std::cout << "Four-step FFT is not faster on the measured sizes" << std::endl;
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -538,4 +538,68 @@ BOOST_AUTO_TEST_CASE(get_vanishing_polynomial) {
                             arithmetic_sequence_domain<field_type>>(4);
 }
 
+BOOST_AUTO_TEST_CASE(cached_evaluation_domain) {
+    typedef curves::bls12<381>::scalar_field_type field_type;
+    typedef typename field_type::value_type value_type;
+
+    const std::size_t m = 16;
+    std::shared_ptr<evaluation_domain<field_type>> cached = get_cached_evaluation_domain<field_type>(m);
+    BOOST_CHECK(cached == get_cached_evaluation_domain<field_type>(m));
+    BOOST_CHECK(cached != get_cached_evaluation_domain<field_type>(2 * m));
+
+    std::shared_ptr<evaluation_domain<field_type>> fresh = make_evaluation_domain<field_type>(m);
+    std::vector<value_type> a(m), b;
+    for (std::size_t i = 0; i < m; ++i) {
+        a[i] = value_type(i * i + 1);
+    }
+    b = a;
+    cached->fft(a);
+    fresh->fft(b);
+    BOOST_CHECK(a == b);
+    cached->inverse_fft(a);
+    fresh->inverse_fft(b);
+    BOOST_CHECK(a == b);
+}
+
+BOOST_AUTO_TEST_CASE(evaluation_domain_cache_eviction) {
+    typedef curves::bls12<381>::scalar_field_type field_type;
+
+    evaluation_domain_cache<field_type> cache(2);
+    std::shared_ptr<evaluation_domain<field_type>> d16 = get_cached_evaluation_domain<field_type>(16, cache);
+    std::shared_ptr<evaluation_domain<field_type>> d32 = cache.get(32);
+    BOOST_CHECK(cache.get(16) == d16);
+
+    // 32 is the least recently used size and is dropped, the domain itself stays valid
+    cache.get(64);
+    BOOST_CHECK_EQUAL(cache.size(), 2);
+    BOOST_CHECK(cache.get(16) == d16);
+    BOOST_CHECK(cache.get(32) != d32);
+    BOOST_CHECK_EQUAL(d32->m, 32);
+
+    cache.clear();
+    BOOST_CHECK_EQUAL(cache.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(evaluation_domain_cache_capacity) {
+    typedef curves::bls12<381>::scalar_field_type field_type;
+
+    evaluation_domain_cache<field_type> cache(3);
+    std::shared_ptr<evaluation_domain<field_type>> d16 = cache.get(16);
+    cache.get(32);
+    cache.get(64);
+    BOOST_CHECK_EQUAL(cache.size(), 3);
+
+    // Shrinking keeps the most recently used sizes only
+    cache.set_capacity(1);
+    BOOST_CHECK_EQUAL(cache.get_capacity(), 1);
+    BOOST_CHECK_EQUAL(cache.size(), 1);
+    BOOST_CHECK(cache.get(16) != d16);
+
+    // Capacity 0 turns the caching off
+    cache.set_capacity(0);
+    BOOST_CHECK_EQUAL(cache.size(), 0);
+    BOOST_CHECK(cache.get(16) != cache.get(16));
+    BOOST_CHECK_EQUAL(cache.size(), 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,79 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE grand_product_test
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/math/algorithms/grand_product.hpp>
+
+using namespace nil::crypto3::algebra;
+using namespace nil::crypto3::math;
+
+typedef fields::bls12_fr<381> FieldType;
+
+BOOST_AUTO_TEST_SUITE(grand_product_test_suite)
+
+BOOST_AUTO_TEST_CASE(grand_product_matches_running_product) {
+    using value_type = FieldType::value_type;
+    // Sizes below and above the chunk size, so that the parallel scan is exercised under MULTICORE.
+    for (std::size_t size : {0, 1, 2, 17, 5000}) {
+        std::vector<value_type> numerators(size), denominators(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            numerators[i] = random_element<FieldType>();
+            denominators[i] = random_element<FieldType>();
+        }
+
+        std::vector<value_type> products = grand_product(numerators, denominators);
+        BOOST_CHECK_EQUAL(products.size(), size + 1);
+
+        value_type expected = value_type::one();
+        BOOST_CHECK(products[0] == expected);
+        for (std::size_t i = 0; i < size; ++i) {
+            expected *= numerators[i] * denominators[i].inversed();
+            BOOST_CHECK(products[i + 1] == expected);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(parallel_batch_inverse_matches_inversed) {
+    using value_type = FieldType::value_type;
+    std::vector<value_type> values(5000);
+    for (auto &x : values) {
+        x = random_element<FieldType>();
+    }
+    values[7] = value_type::zero();
+
+    std::vector<value_type> inversed = values;
+    parallel_batch_inverse(inversed.begin(), inversed.end());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        BOOST_CHECK(inversed[i] == (values[i].is_zero() ? value_type::zero() : values[i].inversed()));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,79 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MP_DETAIL_CPU_FEATURES_HPP
+#define CRYPTO3_MP_DETAIL_CPU_FEATURES_HPP
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(__ZKLLVM__)
+#define CRYPTO3_MP_X86_CPU_FEATURES
+#include <cpuid.h>
+#endif
+
+namespace boost {
+    namespace multiprecision {
+        namespace backends {
+
+            // Runtime detection of the x86 extensions picked by the dispatching kernels of multiprecision,
+            // algebra and hash. The CPU is probed once, the function-local static makes that thread-safe.
+            // The vector extensions are reported only when the OS saves their registers, which is checked
+            // through XCR0.
+            //
+            // The cpuid class of the block library is not used: multiprecision and algebra do not depend on
+            // block, and that class does not check XCR0 and does not know AVX-512 IFMA.
+            struct cpu_features {
+                bool sse41 = false;
+                bool avx2 = false;
+                bool avx512f = false;
+                bool avx512ifma = false;
+                bool bmi2 = false;
+                bool adx = false;
+                bool sha = false;
+
+                static const cpu_features &get() {
+                    static const cpu_features features = detect();
+                    return features;
+                }
+
+            private:
+                static cpu_features detect() {
+                    cpu_features result;
+#ifdef CRYPTO3_MP_X86_CPU_FEATURES
+                    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+                    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0) {
+                        return result;
+                    }
+                    result.sse41 = (ecx & (1u << 19)) != 0;
+
+                    bool os_avx = false, os_avx512 = false;
+                    if ((ecx & (1u << 27)) != 0) {
+                        // OSXSAVE is set, so XCR0 is readable.
+                        unsigned int xcr0_lo = 0, xcr0_hi = 0;
+                        __asm__("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+                        // SSE and AVX state, then opmask and both halves of the ZMM state.
+                        os_avx = (xcr0_lo & 0x06u) == 0x06u;
+                        os_avx512 = os_avx && (xcr0_lo & 0xE0u) == 0xE0u;
+                    }
+
+                    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) == 0) {
+                        return result;
+                    }
+                    result.avx2 = os_avx && (ebx & (1u << 5)) != 0;
+                    result.avx512f = os_avx512 && (ebx & (1u << 16)) != 0;
+                    result.avx512ifma = result.avx512f && (ebx & (1u << 21)) != 0;
+                    result.bmi2 = (ebx & (1u << 8)) != 0;
+                    result.adx = (ebx & (1u << 19)) != 0;
+                    result.sha = (ebx & (1u << 29)) != 0;
+#endif
+                    return result;
+                }
+            };
+        }    // namespace backends
+    }        // namespace multiprecision
+}    // namespace boost
+
+#endif    // CRYPTO3_MP_DETAIL_CPU_FEATURES_HPP
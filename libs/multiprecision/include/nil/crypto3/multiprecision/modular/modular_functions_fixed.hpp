@@ -13,6 +13,7 @@
 
 #include <boost/multiprecision/detail/number_base.hpp>
 #include <nil/crypto3/multiprecision/modular/modular_policy_fixed.hpp>
+#include <nil/crypto3/multiprecision/modular/montgomery_mul_adx.hpp>
 
 #include <boost/mpl/if.hpp>
 
@@ -247,6 +248,7 @@ namespace boost {
                     initialize_montgomery_params();
 
                     m_no_carry_montgomery_mul_allowed = is_applicable_for_no_carry_montgomery_mul();
+                    m_adx_montgomery_mul_allowed = is_applicable_for_adx_montgomery_mul();
                 }
 
             public:
@@ -292,6 +294,7 @@ namespace boost {
                     , m_barrett_mu(o.get_mu())
                     , m_montgomery_r2(o.get_r2())
                     , m_montgomery_p_dash(o.get_p_dash())
+                    , m_adx_montgomery_mul_allowed(o.m_adx_montgomery_mul_allowed)
                 {
                 }
 
@@ -424,6 +427,14 @@ namespace boost {
                         Backend &result, const Backend &y,
                         std::integral_constant<bool, false> const&) const {
 
+#if defined(CRYPTO3_MP_HAS_MONTGOMERY_MUL_ADX) && !defined(BOOST_MP_NO_CONSTEXPR_DETECTION)
+                    // The assembly kernels can run only outside of constant evaluation.
+                    if (!BOOST_MP_IS_CONST_EVALUATED(result.size()) && m_adx_montgomery_mul_allowed &&
+                        has_bmi2_adx()) {
+                        montgomery_mul_adx_impl(result, y);
+                        return;
+                    }
+#endif
                     if ( m_no_carry_montgomery_mul_allowed ) 
                         montgomery_mul_no_carry_impl( 
                                 result, 
@@ -474,6 +485,40 @@ namespace boost {
                     return false;
                 }
 
+                // Tests if the MULX/ADCX/ADOX kernels fit the modulus, the CPU support is checked on each call.
+                template<class Backend1 = Backend>
+                BOOST_MP_CXX14_CONSTEXPR typename boost::enable_if_c<!is_trivial_cpp_int_modular<Backend1>::value, bool>::type
+                    is_applicable_for_adx_montgomery_mul() const {
+#ifdef CRYPTO3_MP_HAS_MONTGOMERY_MUL_ADX
+                    return limb_bits == 64 && montgomery_mul_adx<Backend1::internal_limb_count>::value &&
+                        montgomery_mul_adx_applicable(m_mod.limbs(), Backend1::internal_limb_count);
+#else
+                    return false;
+#endif
+                }
+
+                template<class Backend1 = Backend>
+                BOOST_MP_CXX14_CONSTEXPR typename boost::enable_if_c<is_trivial_cpp_int_modular<Backend1>::value, bool>::type
+                    is_applicable_for_adx_montgomery_mul() const {
+                    return false;
+                }
+
+                template<typename Backend1>
+                typename boost::enable_if_c<montgomery_mul_adx<Backend1::internal_limb_count>::value>::type
+                    montgomery_mul_adx_impl(Backend1 &result, const Backend1 &y) const {
+                    BOOST_ASSERT(eval_lt(result, m_mod) && eval_lt(y, m_mod));
+                    BOOST_ASSERT(is_applicable_for_adx_montgomery_mul());
+
+                    montgomery_mul_adx<Backend1::internal_limb_count>::mul(
+                        result.limbs(), result.limbs(), y.limbs(), m_mod.limbs(), m_montgomery_p_dash);
+                }
+
+                template<typename Backend1>
+                typename boost::enable_if_c<!montgomery_mul_adx<Backend1::internal_limb_count>::value>::type
+                    montgomery_mul_adx_impl(Backend1 &result, const Backend1 &y) const {
+                    montgomery_mul_CIOS_impl(result, y, std::integral_constant<bool, false>());
+                }
+
                 // Non-carry implementation of Montgomery multiplication.
                 // Implemented from pseudo-code at
                 //   "https://hackmd.io/@gnark/modular_multiplication".
@@ -867,6 +912,7 @@ namespace boost {
                     m_montgomery_p_dash = o.get_p_dash();
                     m_mod_compliment = o.get_mod_compliment();
                     m_no_carry_montgomery_mul_allowed = is_applicable_for_no_carry_montgomery_mul();
+                    m_adx_montgomery_mul_allowed = is_applicable_for_adx_montgomery_mul();
 
                     return *this;
                 }
@@ -888,6 +934,10 @@ namespace boost {
                 // If set, no-carry optimization is allowed. Must be initialized by function 
                 // is_applicable_for_no_carry_montgomery_mul() after initialization.
                 bool m_no_carry_montgomery_mul_allowed = false;
+
+                // If set, the MULX/ADCX/ADOX kernels are used on CPUs supporting them. Must be initialized by
+                // function is_applicable_for_adx_montgomery_mul() after initialization.
+                bool m_adx_montgomery_mul_allowed = false;
             };
         }    // namespace backends
     }   // namespace multiprecision
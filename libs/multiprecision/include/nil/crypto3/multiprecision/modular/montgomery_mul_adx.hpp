@@ -0,0 +1,242 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MULTIPRECISION_MODULAR_MONTGOMERY_MUL_ADX_HPP
+#define CRYPTO3_MULTIPRECISION_MODULAR_MONTGOMERY_MUL_ADX_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <nil/crypto3/multiprecision/detail/cpu_features.hpp>
+
+#if defined(CRYPTO3_MP_X86_CPU_FEATURES) && defined(__x86_64__)
+#define CRYPTO3_MP_HAS_MONTGOMERY_MUL_ADX
+#endif
+
+namespace boost {
+    namespace multiprecision {
+        namespace backends {
+
+            // Fully unrolled Montgomery multiplication on 64-bit limbs with MULX, ADCX and ADOX. MULX leaves
+            // the flags alone, so the low and the high halves of the products go into two independent carry
+            // chains, CF and OF.
+            //
+            // The kernels keep the CIOS accumulator in N + 1 registers and require the modulus to leave the top
+            // bit of the top limb unused, see montgomery_mul_adx_applicable. The accumulator then never exceeds
+            // N + 1 limbs and stays below 2 * modulus after every round, so a single conditional subtraction
+            // at the end gives the same canonical result as the portable implementations.
+            template<std::size_t N>
+            struct montgomery_mul_adx {
+                constexpr static const bool value = false;
+            };
+
+#ifdef CRYPTO3_MP_HAS_MONTGOMERY_MUL_ADX
+
+            // BMI2 provides MULX, ADX provides ADCX and ADOX.
+            inline bool has_bmi2_adx() {
+                return cpu_features::get().bmi2 && cpu_features::get().adx;
+            }
+
+            // The most significant limb should be below 2^63 - 1.
+            template<typename Limb>
+            constexpr bool montgomery_mul_adx_applicable(const Limb *modulus, std::size_t limbs_count) {
+                return modulus[limbs_count - 1] < 0x7FFFFFFFFFFFFFFFULL;
+            }
+
+            // Returns t - q when t >= q, otherwise t.
+            template<std::size_t N, typename Limb>
+            inline void montgomery_mul_adx_final_subtract(Limb *r, const Limb *t, const Limb *q) {
+                Limb s[N];
+                Limb borrow = 0;
+                for (std::size_t j = 0; j < N; ++j) {
+                    const Limb d = t[j] - q[j];
+                    const Limb next_borrow = (t[j] < q[j]) | (d < borrow);
+                    s[j] = d - borrow;
+                    borrow = next_borrow;
+                }
+                for (std::size_t j = 0; j < N; ++j) {
+                    r[j] = borrow ? t[j] : s[j];
+                }
+            }
+
+// t_j += lo, t_{j + 1} += hi for the product of rdx with ptr[offset].
+#define CRYPTO3_MP_ADX_MULADD(offset, ptr, t)   \
+    "adcxq %[hi], %[" #t "]\n\t"                \
+    "mulxq " #offset "(%[" #ptr "]), %[lo], %[hi]\n\t" \
+    "adoxq %[lo], %[" #t "]\n\t"
+
+// t = a * b[0]
+#define CRYPTO3_MP_ADX_MUL_FIRST_4(t0, t1, t2, t3, t4) \
+    "movq 0(%[b]), %%rdx\n\t"                          \
+    "xorq %[lo], %[lo]\n\t"                            \
+    "mulxq 0(%[a]), %[" #t0 "], %[" #t1 "]\n\t"        \
+    "mulxq 8(%[a]), %[lo], %[" #t2 "]\n\t"             \
+    "adcxq %[lo], %[" #t1 "]\n\t"                      \
+    "mulxq 16(%[a]), %[lo], %[" #t3 "]\n\t"            \
+    "adcxq %[lo], %[" #t2 "]\n\t"                      \
+    "mulxq 24(%[a]), %[lo], %[" #t4 "]\n\t"            \
+    "adcxq %[lo], %[" #t3 "]\n\t"                      \
+    "adcxq %[zero], %[" #t4 "]\n\t"
+
+// t += a * b[i], t4 is zero on entry.
+#define CRYPTO3_MP_ADX_MUL_ROUND_4(offset, t0, t1, t2, t3, t4) \
+    "movq " #offset "(%[b]), %%rdx\n\t"                         \
+    "xorq %[lo], %[lo]\n\t"                                     \
+    "mulxq 0(%[a]), %[lo], %[hi]\n\t"                           \
+    "adoxq %[lo], %[" #t0 "]\n\t"                               \
+    CRYPTO3_MP_ADX_MULADD(8, a, t1)                             \
+    CRYPTO3_MP_ADX_MULADD(16, a, t2)                            \
+    CRYPTO3_MP_ADX_MULADD(24, a, t3)                            \
+    "adcxq %[hi], %[" #t4 "]\n\t"                               \
+    "adoxq %[zero], %[" #t4 "]\n\t"
+
+// t = (t + m * q) / 2^64 with m = -t0 / q mod 2^64. The quotient lives in t1..t4, t0 becomes zero.
+#define CRYPTO3_MP_ADX_REDUCE_4(t0, t1, t2, t3, t4) \
+    "movq %[" #t0 "], %%rdx\n\t"                     \
+    "imulq %[inv], %%rdx\n\t"                        \
+    "xorq %[lo], %[lo]\n\t"                          \
+    "mulxq 0(%[q]), %[lo], %[hi]\n\t"                \
+    "adoxq %[lo], %[" #t0 "]\n\t"                    \
+    CRYPTO3_MP_ADX_MULADD(8, q, t1)                  \
+    CRYPTO3_MP_ADX_MULADD(16, q, t2)                 \
+    CRYPTO3_MP_ADX_MULADD(24, q, t3)                 \
+    "adcxq %[hi], %[" #t4 "]\n\t"                    \
+    "adoxq %[zero], %[" #t4 "]\n\t"
+
+#define CRYPTO3_MP_ADX_MUL_FIRST_6(t0, t1, t2, t3, t4, t5, t6) \
+    "movq 0(%[b]), %%rdx\n\t"                                  \
+    "xorq %[lo], %[lo]\n\t"                                    \
+    "mulxq 0(%[a]), %[" #t0 "], %[" #t1 "]\n\t"                \
+    "mulxq 8(%[a]), %[lo], %[" #t2 "]\n\t"                     \
+    "adcxq %[lo], %[" #t1 "]\n\t"                              \
+    "mulxq 16(%[a]), %[lo], %[" #t3 "]\n\t"                    \
+    "adcxq %[lo], %[" #t2 "]\n\t"                              \
+    "mulxq 24(%[a]), %[lo], %[" #t4 "]\n\t"                    \
+    "adcxq %[lo], %[" #t3 "]\n\t"                              \
+    "mulxq 32(%[a]), %[lo], %[" #t5 "]\n\t"                    \
+    "adcxq %[lo], %[" #t4 "]\n\t"                              \
+    "mulxq 40(%[a]), %[lo], %[" #t6 "]\n\t"                    \
+    "adcxq %[lo], %[" #t5 "]\n\t"                              \
+    "adcxq %[zero], %[" #t6 "]\n\t"
+
+#define CRYPTO3_MP_ADX_MUL_ROUND_6(offset, t0, t1, t2, t3, t4, t5, t6) \
+    "movq " #offset "(%[b]), %%rdx\n\t"                                 \
+    "xorq %[lo], %[lo]\n\t"                                             \
+    "mulxq 0(%[a]), %[lo], %[hi]\n\t"                                   \
+    "adoxq %[lo], %[" #t0 "]\n\t"                                       \
+    CRYPTO3_MP_ADX_MULADD(8, a, t1)                                     \
+    CRYPTO3_MP_ADX_MULADD(16, a, t2)                                    \
+    CRYPTO3_MP_ADX_MULADD(24, a, t3)                                    \
+    CRYPTO3_MP_ADX_MULADD(32, a, t4)                                    \
+    CRYPTO3_MP_ADX_MULADD(40, a, t5)                                    \
+    "adcxq %[hi], %[" #t6 "]\n\t"                                       \
+    "adoxq %[zero], %[" #t6 "]\n\t"
+
+#define CRYPTO3_MP_ADX_REDUCE_6(t0, t1, t2, t3, t4, t5, t6) \
+    "movq %[" #t0 "], %%rdx\n\t"                             \
+    "imulq %[inv], %%rdx\n\t"                                \
+    "xorq %[lo], %[lo]\n\t"                                  \
+    "mulxq 0(%[q]), %[lo], %[hi]\n\t"                        \
+    "adoxq %[lo], %[" #t0 "]\n\t"                            \
+    CRYPTO3_MP_ADX_MULADD(8, q, t1)                          \
+    CRYPTO3_MP_ADX_MULADD(16, q, t2)                         \
+    CRYPTO3_MP_ADX_MULADD(24, q, t3)                         \
+    CRYPTO3_MP_ADX_MULADD(32, q, t4)                         \
+    CRYPTO3_MP_ADX_MULADD(40, q, t5)                         \
+    "adcxq %[hi], %[" #t6 "]\n\t"                            \
+    "adoxq %[zero], %[" #t6 "]\n\t"
+
+            template<>
+            struct montgomery_mul_adx<4> {
+                constexpr static const bool value = true;
+
+                // r = a * b / 2^256 mod q, with a, b < q and q_inv = -q^-1 mod 2^64. r may alias a or b.
+                template<typename Limb>
+                static inline void mul(Limb *r, const Limb *a, const Limb *b, const Limb *q, Limb q_inv) {
+                    static_assert(sizeof(Limb) == sizeof(std::uint64_t), "64-bit limbs are required");
+                    const Limb zero = 0;
+                    Limb t0, t1, t2, t3, t4, lo, hi;
+
+                    // Every reduction shifts the accumulator down by one register, so the register holding t_0
+                    // moves along the names.
+                    __asm__(CRYPTO3_MP_ADX_MUL_FIRST_4(t0, t1, t2, t3, t4)
+                            CRYPTO3_MP_ADX_REDUCE_4(t0, t1, t2, t3, t4)
+                            CRYPTO3_MP_ADX_MUL_ROUND_4(8, t1, t2, t3, t4, t0)
+                            CRYPTO3_MP_ADX_REDUCE_4(t1, t2, t3, t4, t0)
+                            CRYPTO3_MP_ADX_MUL_ROUND_4(16, t2, t3, t4, t0, t1)
+                            CRYPTO3_MP_ADX_REDUCE_4(t2, t3, t4, t0, t1)
+                            CRYPTO3_MP_ADX_MUL_ROUND_4(24, t3, t4, t0, t1, t2)
+                            CRYPTO3_MP_ADX_REDUCE_4(t3, t4, t0, t1, t2)
+                            : [t0] "=&r"(t0), [t1] "=&r"(t1), [t2] "=&r"(t2), [t3] "=&r"(t3), [t4] "=&r"(t4),
+                              [lo] "=&r"(lo), [hi] "=&r"(hi)
+                            : [a] "r"(a), [b] "r"(b), [q] "r"(q), [inv] "m"(q_inv), [zero] "m"(zero)
+                            : "rdx", "cc", "memory");
+
+                    const Limb t[4] = {t4, t0, t1, t2};
+                    montgomery_mul_adx_final_subtract<4>(r, t, q);
+                }
+
+                template<typename Limb>
+                static inline void square(Limb *r, const Limb *a, const Limb *q, Limb q_inv) {
+                    mul(r, a, a, q, q_inv);
+                }
+            };
+
+            template<>
+            struct montgomery_mul_adx<6> {
+                constexpr static const bool value = true;
+
+                // r = a * b / 2^384 mod q, with a, b < q and q_inv = -q^-1 mod 2^64. r may alias a or b.
+                template<typename Limb>
+                static inline void mul(Limb *r, const Limb *a, const Limb *b, const Limb *q, Limb q_inv) {
+                    static_assert(sizeof(Limb) == sizeof(std::uint64_t), "64-bit limbs are required");
+                    const Limb zero = 0;
+                    Limb t0, t1, t2, t3, t4, t5, t6, lo, hi;
+
+                    __asm__(CRYPTO3_MP_ADX_MUL_FIRST_6(t0, t1, t2, t3, t4, t5, t6)
+                            CRYPTO3_MP_ADX_REDUCE_6(t0, t1, t2, t3, t4, t5, t6)
+                            CRYPTO3_MP_ADX_MUL_ROUND_6(8, t1, t2, t3, t4, t5, t6, t0)
+                            CRYPTO3_MP_ADX_REDUCE_6(t1, t2, t3, t4, t5, t6, t0)
+                            CRYPTO3_MP_ADX_MUL_ROUND_6(16, t2, t3, t4, t5, t6, t0, t1)
+                            CRYPTO3_MP_ADX_REDUCE_6(t2, t3, t4, t5, t6, t0, t1)
+                            CRYPTO3_MP_ADX_MUL_ROUND_6(24, t3, t4, t5, t6, t0, t1, t2)
+                            CRYPTO3_MP_ADX_REDUCE_6(t3, t4, t5, t6, t0, t1, t2)
+                            CRYPTO3_MP_ADX_MUL_ROUND_6(32, t4, t5, t6, t0, t1, t2, t3)
+                            CRYPTO3_MP_ADX_REDUCE_6(t4, t5, t6, t0, t1, t2, t3)
+                            CRYPTO3_MP_ADX_MUL_ROUND_6(40, t5, t6, t0, t1, t2, t3, t4)
+                            CRYPTO3_MP_ADX_REDUCE_6(t5, t6, t0, t1, t2, t3, t4)
+                            : [t0] "=&r"(t0), [t1] "=&r"(t1), [t2] "=&r"(t2), [t3] "=&r"(t3), [t4] "=&r"(t4),
+                              [t5] "=&r"(t5), [t6] "=&r"(t6), [lo] "=&r"(lo), [hi] "=&r"(hi)
+                            : [a] "r"(a), [b] "r"(b), [q] "r"(q), [inv] "m"(q_inv), [zero] "m"(zero)
+                            : "rdx", "cc", "memory");
+
+                    const Limb t[6] = {t6, t0, t1, t2, t3, t4};
+                    montgomery_mul_adx_final_subtract<6>(r, t, q);
+                }
+
+                template<typename Limb>
+                static inline void square(Limb *r, const Limb *a, const Limb *q, Limb q_inv) {
+                    mul(r, a, a, q, q_inv);
+                }
+            };
+
+#undef CRYPTO3_MP_ADX_REDUCE_6
+#undef CRYPTO3_MP_ADX_MUL_ROUND_6
+#undef CRYPTO3_MP_ADX_MUL_FIRST_6
+#undef CRYPTO3_MP_ADX_REDUCE_4
+#undef CRYPTO3_MP_ADX_MUL_ROUND_4
+#undef CRYPTO3_MP_ADX_MUL_FIRST_4
+#undef CRYPTO3_MP_ADX_MULADD
+
+#endif    // CRYPTO3_MP_HAS_MONTGOMERY_MUL_ADX
+
+        }    // namespace backends
+    }        // namespace multiprecision
+}    // namespace boost
+
+#endif    // CRYPTO3_MULTIPRECISION_MODULAR_MONTGOMERY_MUL_ADX_HPP
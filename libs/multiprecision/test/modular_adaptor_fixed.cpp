@@ -21,6 +21,7 @@
 
 #include <chrono>
 #include <iostream>
+#include <random>
 #include <vector>
 
 // We need cpp_int to compare to it.
@@ -32,6 +33,7 @@
 
 #include <nil/crypto3/multiprecision/modular/modular_adaptor.hpp>
 #include <nil/crypto3/multiprecision/modular/modular_params_fixed.hpp>
+#include <nil/crypto3/multiprecision/modular/montgomery_mul_adx.hpp>
 
 #include <nil/crypto3/multiprecision/inverse.hpp>
 
@@ -189,6 +191,76 @@ bool base_operations_test(std::array<std::array<Number, enum_len>, N> test_data)
 }
 
 
+// Multiplications through modular_adaptor go to the MULX/ADCX/ADOX kernels where the CPU and the modulus allow it.
+// The results are canonical, so they have to match cpp_int bit by bit. When the kernels are available, they are also
+// checked directly against the Montgomery product.
+template<unsigned Bits>
+void montgomery_mul_adx_cross_check(const char *modulus_hex) {
+    using Backend = cpp_int_modular_backend<Bits>;
+    typedef typename Backend::cpp_int_type CppIntBackend;
+    typedef typename boost::multiprecision::default_ops::double_precision_type<CppIntBackend>::type CppIntBackend_doubled;
+    using modular_adaptor_type = modular_adaptor<Backend, modular_params_rt<Backend>>;
+    typedef boost::multiprecision::number<modular_adaptor_type> modular_number;
+    typedef boost::multiprecision::number<CppIntBackend> standard_number;
+    typedef boost::multiprecision::number<CppIntBackend_doubled> dbl_standard_number;
+
+    constexpr std::size_t limbs_count = Backend::internal_limb_count;
+    const standard_number m(modulus_hex);
+    const Backend m_backend(m.backend());
+
+    std::mt19937_64 rng(Bits);
+    auto random_value = [&]() {
+        standard_number x = 0;
+        for (std::size_t i = 0; i < limbs_count; ++i) {
+            x <<= 64;
+            x += rng();
+        }
+        return standard_number(x % m);
+    };
+
+    std::vector<standard_number> values = {0, 1, 2, m - 1, m - 2};
+    for (std::size_t i = 0; i < 100; ++i) {
+        values.push_back(random_value());
+    }
+
+    for (const auto &a : values) {
+        for (std::size_t k = 0; k < 10; ++k) {
+            const standard_number &b = values[rng() % values.size()];
+            modular_number a_m(modular_adaptor_type(Backend(a.backend()), m_backend));
+            modular_number b_m(modular_adaptor_type(Backend(b.backend()), m_backend));
+
+            dbl_standard_number a_mul_b_s = (dbl_standard_number(a) * dbl_standard_number(b)) % dbl_standard_number(m);
+            dbl_standard_number a_sqr_s = (dbl_standard_number(a) * dbl_standard_number(a)) % dbl_standard_number(m);
+            BOOST_CHECK_EQUAL(dbl_standard_number(standard_number((a_m * b_m).backend().convert_to_cpp_int())),
+                              a_mul_b_s);
+            BOOST_CHECK_EQUAL(dbl_standard_number(standard_number((a_m * a_m).backend().convert_to_cpp_int())),
+                              a_sqr_s);
+
+#ifdef CRYPTO3_MP_HAS_MONTGOMERY_MUL_ADX
+            if constexpr (boost::multiprecision::backends::montgomery_mul_adx<limbs_count>::value) {
+                if (boost::multiprecision::backends::has_bmi2_adx() &&
+                    boost::multiprecision::backends::montgomery_mul_adx_applicable(m_backend.limbs(), limbs_count)) {
+                    auto q_inv = m_backend.limbs()[0];
+                    // Newton iterations for q^-1 mod 2^64
+                    for (int i = 0; i < 6; ++i) {
+                        q_inv *= 2 - m_backend.limbs()[0] * q_inv;
+                    }
+                    q_inv = -q_inv;
+
+                    Backend r, a_backend(a.backend()), b_backend(b.backend());
+                    boost::multiprecision::backends::montgomery_mul_adx<limbs_count>::mul(
+                        r.limbs(), a_backend.limbs(), b_backend.limbs(), m_backend.limbs(), q_inv);
+                    // r = a * b / 2^(64 * limbs_count)
+                    dbl_standard_number r_s = dbl_standard_number(standard_number(r.to_cpp_int()));
+                    BOOST_CHECK(r_s < dbl_standard_number(m));
+                    BOOST_CHECK_EQUAL((r_s << (64 * limbs_count)) % dbl_standard_number(m), a_mul_b_s);
+                }
+            }
+#endif
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE(static_tests)
 
 BOOST_AUTO_TEST_CASE(base_ops_prime_mod_backend_130) {
@@ -517,4 +589,19 @@ BOOST_AUTO_TEST_CASE(conversion_to_shorter_number) {
     BOOST_CHECK_EQUAL(s, 0xfffffffffffffffffffffffefffffc2f_cppui_modular128);
 }
 
+BOOST_AUTO_TEST_CASE(montgomery_mul_adx_cross_check_4_limbs) {
+    // alt_bn128, pallas and vesta base fields
+    montgomery_mul_adx_cross_check<254>("0x30644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd47");
+    montgomery_mul_adx_cross_check<255>("0x40000000000000000000000000000000224698fc094cf91b992d30ed00000001");
+    montgomery_mul_adx_cross_check<255>("0x40000000000000000000000000000000224698fc0994a8dd8c46eb2100000001");
+    // secp256k1 base field leaves no spare bit and falls back to the portable implementation
+    montgomery_mul_adx_cross_check<256>("0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f");
+}
+
+BOOST_AUTO_TEST_CASE(montgomery_mul_adx_cross_check_6_limbs) {
+    // bls12-381 base field
+    montgomery_mul_adx_cross_check<381>(
+        "0x1a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb153ffffb9feffffffffaaab");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,165 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_BATCH_VERIFY_HPP
+#define CRYPTO3_PUBKEY_BATCH_VERIFY_HPP
+
+#include <iterator>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/pubkey/algorithm/pubkey.hpp>
+
+#include <nil/crypto3/pubkey/pubkey_value.hpp>
+#include <nil/crypto3/pubkey/pubkey_state.hpp>
+
+#include <nil/crypto3/pubkey/modes/isomorphic.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            template<typename Scheme>
+            using batch_verification_policy = typename pubkey::modes::isomorphic<Scheme>::batch_verification_policy;
+
+            template<typename Scheme>
+            using batch_verification_processing_mode_default =
+                typename modes::isomorphic<Scheme>::template bind<batch_verification_policy<Scheme>>::type;
+        }    // namespace pubkey
+
+        /*!
+         * @brief Batch verification of independent signatures. The i-th signature is verified against the i-th
+         * message on the i-th public key, all of them are checked at once with a random linear combination.
+         *
+         * @ingroup pubkey_algorithms
+         *
+         * @tparam Scheme public key signature scheme
+         * @tparam MessageRanges range of ranges representing input messages
+         * @tparam SignatureRange range representing input signatures
+         * @tparam KeyRange range representing input public keys
+         * @tparam ProcessingMode a policy representing a work mode of the scheme, by default isomorphic, which means
+         * executing a batch verification operation as in specification
+         * @tparam BatchVerificationAccumulator accumulator set initialized with batch verification accumulator
+         * (internal parameter)
+         * @tparam StreamSchemeImpl (internal parameter)
+         * @tparam SchemeImpl return type implicitly convertible to \p BatchVerificationAccumulator or \p
+         * ProcessingMode::result_type (internal parameter)
+         *
+         * @param msgs messages
+         * @param signatures signatures of the messages
+         * @param keys public keys, which corresponding private keys were used to sign the messages
+         *
+         * @return \p SchemeImpl, \p ProcessingMode::result_type holds indices of invalid signatures
+         */
+        template<typename Scheme, typename MessageRanges, typename SignatureRange, typename KeyRange,
+                 typename ProcessingMode = pubkey::batch_verification_processing_mode_default<Scheme>,
+                 typename BatchVerificationAccumulator = pubkey::batch_verification_accumulator_set<ProcessingMode>,
+                 typename StreamSchemeImpl = pubkey::detail::value_pubkey_impl<BatchVerificationAccumulator>,
+                 typename SchemeImpl = pubkey::detail::range_pubkey_impl<StreamSchemeImpl>>
+        SchemeImpl batch_verify(const MessageRanges &msgs, const SignatureRange &signatures, const KeyRange &keys) {
+            BOOST_ASSERT(std::distance(std::cbegin(msgs), std::cend(msgs)) ==
+                             std::distance(std::cbegin(signatures), std::cend(signatures)) &&
+                         std::distance(std::cbegin(msgs), std::cend(msgs)) ==
+                             std::distance(std::cbegin(keys), std::cend(keys)));
+
+            BatchVerificationAccumulator acc;
+            auto signatures_iter = std::cbegin(signatures);
+            auto keys_iter = std::cbegin(keys);
+            for (const auto &msg : msgs) {
+                const pubkey::public_key<Scheme> &key = *keys_iter++;
+                acc(msg, ::nil::crypto3::accumulators::key = key,
+                    ::nil::crypto3::accumulators::signature = *signatures_iter++);
+            }
+            return SchemeImpl(std::move(acc));
+        }
+
+        /*!
+         * @brief Updating of accumulator set \p acc containing batch verification accumulator with input message,
+         * its signature and corresponding public key
+         *
+         * @ingroup pubkey_algorithms
+         *
+         * @tparam Scheme public key signature scheme
+         * @tparam InputIterator iterator representing input message
+         * @tparam ProcessingMode a policy representing a work mode of the scheme, by default isomorphic, which means
+         * executing a batch verification operation as in specification
+         * @tparam OutputAccumulator accumulator set initialized with batch verification accumulator (internal
+         * parameter)
+         *
+         * @param first the beginning of the message range, corresponding to passed \p key
+         * @param last the end of the message range, corresponding to passed \p key
+         * @param signature signature of the message
+         * @param key public key, which corresponding private key was used to sign the passed message
+         * @param acc accumulator set containing batch verification accumulator
+         *
+         * @return \p OutputAccumulator
+         */
+        template<typename Scheme, typename InputIterator,
+                 typename ProcessingMode = pubkey::batch_verification_processing_mode_default<Scheme>,
+                 typename OutputAccumulator = pubkey::batch_verification_accumulator_set<ProcessingMode>>
+        typename std::enable_if<boost::accumulators::detail::is_accumulator_set<OutputAccumulator>::value,
+                                OutputAccumulator>::type &
+            batch_verify(InputIterator first, InputIterator last,
+                         const typename pubkey::public_key<Scheme>::signature_type &signature,
+                         const pubkey::public_key<Scheme> &key, OutputAccumulator &acc) {
+            acc(first, ::nil::crypto3::accumulators::iterator_last = last, ::nil::crypto3::accumulators::key = key,
+                ::nil::crypto3::accumulators::signature = signature);
+            return acc;
+        }
+
+        /*!
+         * @brief Updating of accumulator set \p acc containing batch verification accumulator with input message,
+         * its signature and corresponding public key
+         *
+         * @ingroup pubkey_algorithms
+         *
+         * @tparam Scheme public key signature scheme
+         * @tparam SinglePassRange range representing input message
+         * @tparam ProcessingMode a policy representing a work mode of the scheme, by default isomorphic, which means
+         * executing a batch verification operation as in specification
+         * @tparam OutputAccumulator accumulator set initialized with batch verification accumulator (internal
+         * parameter)
+         *
+         * @param range the message range, corresponding to passed \p key
+         * @param signature signature of the message
+         * @param key public key, which corresponding private key was used to sign the passed message
+         * @param acc accumulator set containing batch verification accumulator
+         *
+         * @return \p OutputAccumulator
+         */
+        template<typename Scheme, typename SinglePassRange,
+                 typename ProcessingMode = pubkey::batch_verification_processing_mode_default<Scheme>,
+                 typename OutputAccumulator = pubkey::batch_verification_accumulator_set<ProcessingMode>>
+        typename std::enable_if<boost::accumulators::detail::is_accumulator_set<OutputAccumulator>::value,
+                                OutputAccumulator>::type &
+            batch_verify(const SinglePassRange &range,
+                         const typename pubkey::public_key<Scheme>::signature_type &signature,
+                         const pubkey::public_key<Scheme> &key, OutputAccumulator &acc) {
+            acc(range, ::nil::crypto3::accumulators::key = key,
+                ::nil::crypto3::accumulators::signature = signature);
+            return acc;
+        }
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_BATCH_VERIFY_HPP
@@ -53,6 +53,7 @@
 #include <nil/crypto3/pubkey/operations/aggregate_op.hpp>
 #include <nil/crypto3/pubkey/operations/aggregate_verify_op.hpp>
 #include <nil/crypto3/pubkey/operations/aggregate_verify_single_msg_op.hpp>
+#include <nil/crypto3/pubkey/operations/batch_verify_op.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -75,6 +76,8 @@ namespace nil {
                 typedef typename basic_functions::internal_accumulator_type internal_accumulator_type;
                 typedef typename basic_functions::internal_aggregation_accumulator_type
                     internal_aggregation_accumulator_type;
+                typedef typename basic_functions::internal_batch_verification_accumulator_type
+                    internal_batch_verification_accumulator_type;
 
                 static inline public_key_type generate_public_key(const private_key_type &privkey) {
                     return basic_functions::privkey_to_pubkey(privkey);
@@ -121,6 +124,11 @@ namespace nil {
                     // TODO: add check - If any two input messages are equal, return INVALID.
                     return basic_functions::aggregate_verify(acc, signature);
                 }
+
+                static inline std::vector<std::size_t>
+                    batch_verify(const internal_batch_verification_accumulator_type &acc) {
+                    return basic_functions::batch_verify(acc);
+                }
             };
 
             /*!
@@ -141,6 +149,8 @@ namespace nil {
                 typedef typename basic_functions::internal_accumulator_type internal_accumulator_type;
                 typedef typename basic_functions::internal_aggregation_accumulator_type
                     internal_aggregation_accumulator_type;
+                typedef typename basic_functions::internal_batch_verification_accumulator_type
+                    internal_batch_verification_accumulator_type;
 
                 static inline public_key_type generate_public_key(const private_key_type &privkey) {
                     return basic_functions::privkey_to_pubkey(privkey);
@@ -188,6 +198,11 @@ namespace nil {
                                                     const signature_type &signature) {
                     return basic_functions::aggregate_verify(acc, signature);
                 }
+
+                static inline std::vector<std::size_t>
+                    batch_verify(const internal_batch_verification_accumulator_type &acc) {
+                    return basic_functions::batch_verify(acc);
+                }
             };
 
             /*!
@@ -208,6 +223,8 @@ namespace nil {
                 typedef typename basic_functions::internal_accumulator_type internal_accumulator_type;
                 typedef typename basic_functions::internal_aggregation_accumulator_type
                     internal_aggregation_accumulator_type;
+                typedef typename basic_functions::internal_batch_verification_accumulator_type
+                    internal_batch_verification_accumulator_type;
                 typedef typename basic_functions::internal_fast_aggregation_accumulator_type
                     internal_fast_aggregation_accumulator_type;
 
@@ -261,6 +278,11 @@ namespace nil {
                     return basic_functions::aggregate_verify(acc, signature);
                 }
 
+                static inline std::vector<std::size_t>
+                    batch_verify(const internal_batch_verification_accumulator_type &acc) {
+                    return basic_functions::batch_verify(acc);
+                }
+
                 static inline signature_type pop_prove(const private_key_type &privkey) {
                     return basic_functions::pop_prove(privkey);
                 }
@@ -351,6 +373,7 @@ namespace nil {
                 typedef private_key<self_type> private_key_type;
                 typedef aggregate_op<self_type> aggregate_op_policy;
                 typedef aggregate_verify_op<self_type> aggregate_verify_op_policy;
+                typedef batch_verify_op<self_type> batch_verify_op_policy;
             };
 
             template<typename PublicParams, template<typename, typename> class BlsVersion,
@@ -558,6 +581,54 @@ namespace nil {
                 }
             };
 
+            template<typename PublicParams, template<typename, typename> class BlsVersion,
+                     template<typename> class BlsScheme, typename CurveType>
+            struct batch_verify_op<bls<PublicParams, BlsVersion, BlsScheme, CurveType>> {
+                typedef bls<PublicParams, BlsVersion, BlsScheme, CurveType> scheme_type;
+                typedef typename scheme_type::bls_scheme_type bls_scheme_type;
+                typedef public_key<scheme_type> scheme_public_key_type;
+
+                typedef typename bls_scheme_type::private_key_type private_key_type;
+                typedef typename bls_scheme_type::public_key_type public_key_type;
+                typedef typename bls_scheme_type::signature_type signature_type;
+
+                typedef typename bls_scheme_type::internal_accumulator_type _internal_accumulator_type;
+                typedef typename bls_scheme_type::internal_batch_verification_accumulator_type
+                    internal_accumulator_type;
+                // indices of invalid signatures in the order of update calls
+                typedef std::vector<std::size_t> result_type;
+
+                static inline void init_accumulator(internal_accumulator_type &acc) {
+                }
+
+                template<typename InputIterator>
+                static inline void update(internal_accumulator_type &acc, const scheme_public_key_type &scheme_pubkey,
+                                          InputIterator first, InputIterator last, const signature_type &sig) {
+                    bls_scheme_type::update(append(acc, scheme_pubkey, sig), first, last);
+                }
+
+                template<typename InputRange>
+                static inline void update(internal_accumulator_type &acc, const scheme_public_key_type &scheme_pubkey,
+                                          const InputRange &range, const signature_type &sig) {
+                    bls_scheme_type::update(append(acc, scheme_pubkey, sig), range);
+                }
+
+                static inline result_type process(internal_accumulator_type &acc) {
+                    return bls_scheme_type::batch_verify(acc);
+                }
+
+            private:
+                static inline _internal_accumulator_type &append(internal_accumulator_type &acc,
+                                                                 const scheme_public_key_type &scheme_pubkey,
+                                                                 const signature_type &sig) {
+                    acc.pk_n.push_back(scheme_pubkey.public_key_data());
+                    acc.sig_n.push_back(sig);
+                    acc.msg_acc_n.push_back(_internal_accumulator_type());
+                    bls_scheme_type::init_accumulator(acc.msg_acc_n.back(), acc.pk_n.back());
+                    return acc.msg_acc_n.back();
+                }
+            };
+
             template<typename PublicParams, template<typename, typename> class BlsVersion, typename CurveType>
             struct aggregate_verify_single_msg_op<bls<PublicParams, BlsVersion, bls_pop_scheme, CurveType>> {
                 typedef bls<PublicParams, BlsVersion, bls_pop_scheme, CurveType> scheme_type;
@@ -32,6 +32,7 @@
 #include <type_traits>
 #include <iterator>
 #include <algorithm>
+#include <cstdint>
 
 #include <boost/assert.hpp>
 #include <boost/concept_check.hpp>
@@ -39,6 +40,9 @@
 #include <boost/range/concepts.hpp>
 
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/detail/subgroup_check.hpp>
+
+#include <nil/crypto3/random/algebraic_random_device.hpp>
 
 #include <nil/crypto3/hash/algorithm/hash.hpp>
 
@@ -67,6 +71,17 @@ namespace nil {
                     typedef std::pair<std::vector<public_key_type>, internal_accumulator_type>
                         internal_fast_aggregation_accumulator_type;
 
+                    struct internal_batch_verification_accumulator_type {
+                        std::vector<public_key_type> pk_n;
+                        std::vector<internal_accumulator_type> msg_acc_n;
+                        std::vector<signature_type> sig_n;
+                    };
+
+                    // Bit length of the random coefficients of the batch verification linear combination. Keys and
+                    // signatures outside the prime-order subgroups are rejected before combining, so a batch
+                    // containing an invalid signature passes with probability at most 1 / (2^batch_scalar_bits - 1).
+                    constexpr static const std::size_t batch_scalar_bits = 64;
+
                     constexpr static const std::size_t private_key_bits = policy_type::private_key_bits;
                     constexpr static const std::size_t L = static_cast<std::size_t>((3 * private_key_bits) / 16) +
                                                            static_cast<std::size_t>((3 * private_key_bits) % 16 != 0);
@@ -124,9 +139,9 @@ namespace nil {
                             return false;
                         }
                         signature_type Q = nil::crypto3::accumulators::extract::hash<h2c_policy>(acc);
-                        auto C1 = policy_type::pairing(Q, pk);
-                        auto C2 = policy_type::pairing(sig, public_key_type::one());
-                        return C1 == C2;
+                        // e(Q, pk) == e(sig, g)
+                        return policy_type::multi_pairing({Q, -sig}, {pk, public_key_type::one()}) ==
+                               gt_value_type::one();
                     }
 
                     template<
@@ -164,17 +179,25 @@ namespace nil {
                         if (!sig.is_well_formed()) {
                             return false;
                         }
+                        // prod e(Q_i, pk_i) == e(sig, g) with a single Miller loop and final exponentiation.
+                        std::vector<signature_type> Q_n;
+                        std::vector<public_key_type> P_n;
+                        Q_n.reserve(pk_n.size() + 1);
+                        P_n.reserve(pk_n.size() + 1);
+
                         auto pk_n_iter = std::cbegin(pk_n);
                         auto acc_n_iter = std::cbegin(acc_n);
-                        gt_value_type C1 = gt_value_type::one();
                         while (pk_n_iter != std::cend(pk_n) && acc_n_iter != std::cend(acc_n)) {
                             if (!validate_public_key(*pk_n_iter)) {
                                 return false;
                             }
-                            signature_type Q = nil::crypto3::accumulators::extract::hash<h2c_policy>(*acc_n_iter++);
-                            C1 = C1 * policy_type::pairing(Q, *pk_n_iter++);
+                            Q_n.emplace_back(nil::crypto3::accumulators::extract::hash<h2c_policy>(*acc_n_iter++));
+                            P_n.emplace_back(*pk_n_iter++);
                         }
-                        return C1 == policy_type::pairing(sig, public_key_type::one());
+                        Q_n.emplace_back(-sig);
+                        P_n.emplace_back(public_key_type::one());
+
+                        return policy_type::multi_pairing(Q_n, P_n) == gt_value_type::one();
                     }
 
                     static inline bool aggregate_verify(const internal_fast_aggregation_accumulator_type &acc,
@@ -192,6 +215,53 @@ namespace nil {
                         return verify(msg_acc, aggregate_p, sig);
                     }
 
+                    /*!
+                     * @brief Verifies independent (pk_i, msg_i, sig_i) triples at once by checking
+                     * prod e(r_i * Q_i, pk_i) * e(-sum r_i * sig_i, g) == 1 for random r_i. If the combined check
+                     * fails, the batch is bisected to find the invalid triples.
+                     *
+                     * Keys and signatures are checked to lie in the prime-order subgroups first: a small-order
+                     * component would survive the linear combination with probability about one over its order.
+                     *
+                     * @return indices of invalid triples in ascending order, empty if all of them are valid
+                     */
+                    template<typename Generator =
+                                 random::algebraic_random_device<typename curve_type::scalar_field_type>>
+                    static inline std::vector<std::size_t>
+                        batch_verify(const internal_batch_verification_accumulator_type &acc) {
+                        const std::size_t n = acc.pk_n.size();
+                        assert(n == acc.msg_acc_n.size() && n == acc.sig_n.size());
+
+                        std::vector<std::size_t> invalid_n;
+                        std::vector<std::size_t> index_n;
+                        std::vector<signature_type> rQ_n;
+                        std::vector<signature_type> rsig_n;
+                        index_n.reserve(n);
+                        rQ_n.reserve(n);
+                        rsig_n.reserve(n);
+
+                        Generator gen;
+                        for (std::size_t i = 0; i < n; ++i) {
+                            if (!acc.sig_n[i].is_well_formed() || !validate_public_key(acc.pk_n[i]) ||
+                                !algebra::curves::detail::subgroup_check(acc.sig_n[i]) ||
+                                !algebra::curves::detail::subgroup_check(acc.pk_n[i])) {
+                                invalid_n.push_back(i);
+                                continue;
+                            }
+                            const private_key_type r = batch_scalar(gen);
+                            index_n.push_back(i);
+                            signature_type Q = nil::crypto3::accumulators::extract::hash<h2c_policy>(acc.msg_acc_n[i]);
+                            rQ_n.emplace_back(r * Q);
+                            rsig_n.emplace_back(r * acc.sig_n[i]);
+                        }
+
+                        if (!index_n.empty()) {
+                            batch_bisect(rQ_n, rsig_n, acc.pk_n, index_n, 0, index_n.size(), false, invalid_n);
+                        }
+                        std::sort(invalid_n.begin(), invalid_n.end());
+                        return invalid_n;
+                    }
+
                     static inline signature_type pop_prove(const private_key_type &sk) {
                         assert(validate_private_key(sk));
 
@@ -208,9 +278,9 @@ namespace nil {
                             return false;
                         }
                         signature_type Q = hash<h2c_policy>(point_to_pubkey(pk));
-                        auto C1 = policy_type::pairing(Q, pk);
-                        auto C2 = policy_type::pairing(pop, public_key_type::one());
-                        return C1 == C2;
+                        // e(Q, pk) == e(pop, g)
+                        return policy_type::multi_pairing({Q, -pop}, {pk, public_key_type::one()}) ==
+                               gt_value_type::one();
                     }
 
                     static inline public_key_serialized_type point_to_pubkey(const public_key_type &pk) {
@@ -220,6 +290,67 @@ namespace nil {
                     static inline signature_serialized_type point_to_signature(const signature_type &sig) {
                         return bls_serializer::point_to_octets_compress(sig);
                     }
+
+                private:
+                    // Low batch_scalar_bits bits of a uniform scalar, non-zero
+                    template<typename Generator>
+                    static inline private_key_type batch_scalar(Generator &gen) {
+                        typedef typename curve_type::scalar_field_type::integral_type integral_type;
+
+                        const integral_type mask = (integral_type(1u) << batch_scalar_bits) - 1u;
+                        integral_type r = 0u;
+                        while (r.is_zero()) {
+                            r = integral_type(gen().data) & mask;
+                        }
+                        return private_key_type(r);
+                    }
+
+                    // prod e(r_i * Q_i, pk_i) * e(-sum r_i * sig_i, g) == 1 over the triples index_n[first, last)
+                    static inline bool batch_check(const std::vector<signature_type> &rQ_n,
+                                                   const std::vector<signature_type> &rsig_n,
+                                                   const std::vector<public_key_type> &pk_n,
+                                                   const std::vector<std::size_t> &index_n, std::size_t first,
+                                                   std::size_t last) {
+                        std::vector<signature_type> Q_n;
+                        std::vector<public_key_type> P_n;
+                        Q_n.reserve(last - first + 1);
+                        P_n.reserve(last - first + 1);
+
+                        signature_type sig = signature_type::zero();
+                        for (std::size_t i = first; i < last; ++i) {
+                            Q_n.emplace_back(rQ_n[i]);
+                            P_n.emplace_back(pk_n[index_n[i]]);
+                            sig = sig + rsig_n[i];
+                        }
+                        Q_n.emplace_back(-sig);
+                        P_n.emplace_back(public_key_type::one());
+
+                        return policy_type::multi_pairing(Q_n, P_n) == gt_value_type::one();
+                    }
+
+                    // If the left half of a failed range passes, the right half is known to fail and is split
+                    // without checking it as a whole.
+                    static inline void batch_bisect(const std::vector<signature_type> &rQ_n,
+                                                    const std::vector<signature_type> &rsig_n,
+                                                    const std::vector<public_key_type> &pk_n,
+                                                    const std::vector<std::size_t> &index_n, std::size_t first,
+                                                    std::size_t last, bool known_invalid,
+                                                    std::vector<std::size_t> &invalid_n) {
+                        if (!known_invalid && batch_check(rQ_n, rsig_n, pk_n, index_n, first, last)) {
+                            return;
+                        }
+                        if (last - first == 1) {
+                            invalid_n.push_back(index_n[first]);
+                            return;
+                        }
+
+                        const std::size_t middle = first + (last - first) / 2;
+                        const bool left_valid = batch_check(rQ_n, rsig_n, pk_n, index_n, first, middle);
+                        if (!left_valid) {
+                            batch_bisect(rQ_n, rsig_n, pk_n, index_n, first, middle, true, invalid_n);
+                        }
+                        batch_bisect(rQ_n, rsig_n, pk_n, index_n, middle, last, left_valid, invalid_n);
+                    }
                 };
             }    // namespace detail
         }        // namespace pubkey
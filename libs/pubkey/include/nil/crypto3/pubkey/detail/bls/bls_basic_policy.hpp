@@ -27,6 +27,7 @@
 #define CRYPTO3_PUBKEY_BLS_BASIC_POLICY_HPP
 
 #include <cstddef>
+#include <vector>
 
 #include <nil/crypto3/hash/algorithm/hash.hpp>
 #include <nil/crypto3/hash/h2c.hpp>
@@ -85,6 +86,12 @@ namespace nil {
                     static inline gt_value_type pairing(const signature_type &U, const public_key_type &V) {
                         return algebra::pair_reduced<curve_type>(U, V);
                     }
+
+                    // Product of pairing(U[i], V[i]) with a single final exponentiation.
+                    static inline gt_value_type multi_pairing(const std::vector<signature_type> &U,
+                                                              const std::vector<public_key_type> &V) {
+                        return algebra::multi_pair_reduced<curve_type>(U, V);
+                    }
                 };
 
                 //
@@ -122,6 +129,12 @@ namespace nil {
                         return algebra::pair_reduced<curve_type>(V, U);
                     }
 
+                    // Product of pairing(U[i], V[i]) with a single final exponentiation.
+                    static inline gt_value_type multi_pairing(const std::vector<signature_type> &U,
+                                                              const std::vector<public_key_type> &V) {
+                        return algebra::multi_pair_reduced<curve_type>(V, U);
+                    }
+
                     static inline public_key_serialized_type point_to_pubkey(const public_key_type &pubkey) {
                         return bls_serializer::point_to_octets_compress(pubkey);
                     }
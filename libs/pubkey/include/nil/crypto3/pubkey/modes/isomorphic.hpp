@@ -33,6 +33,7 @@
 #include <nil/crypto3/pubkey/operations/aggregate_op.hpp>
 #include <nil/crypto3/pubkey/operations/aggregate_verify_op.hpp>
 #include <nil/crypto3/pubkey/operations/aggregate_verify_single_msg_op.hpp>
+#include <nil/crypto3/pubkey/operations/batch_verify_op.hpp>
 #include <nil/crypto3/pubkey/operations/deal_shares_op.hpp>
 #include <nil/crypto3/pubkey/operations/verify_share_op.hpp>
 #include <nil/crypto3/pubkey/operations/reconstruct_secret_op.hpp>
@@ -226,6 +227,7 @@ namespace nil {
                         aggregate_verification_policy;
                     typedef detail::isomorphic_operation_policy<aggregate_verify_single_msg_op<scheme_type>>
                         single_msg_aggregate_verification_policy;
+                    typedef detail::isomorphic_operation_policy<batch_verify_op<scheme_type>> batch_verification_policy;
                     typedef detail::isomorphic_pop_proving_policy<scheme_type> pop_proving_policy;
                     typedef detail::isomorphic_pop_verification_policy<scheme_type> pop_verification_policy;
                     typedef detail::isomorphic_operation_policy<deal_shares_op<scheme_type>> shares_dealing_policy;
@@ -35,6 +35,7 @@
 #include <nil/crypto3/pubkey/accumulators/aggregate.hpp>
 #include <nil/crypto3/pubkey/accumulators/aggregate_verify.hpp>
 #include <nil/crypto3/pubkey/accumulators/aggregate_verify_single_msg.hpp>
+#include <nil/crypto3/pubkey/accumulators/batch_verify.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -113,6 +114,20 @@ namespace nil {
             using single_msg_aggregate_verification_accumulator_set = boost::accumulators::accumulator_set<
                 typename ProcessingMode::result_type,
                 boost::accumulators::features<accumulators::tag::aggregate_verify_single_msg<ProcessingMode>>>;
+
+            /*!
+             * @brief Accumulator set with pre-defined batch verification accumulator params.
+             *
+             * Meets the requirements of AccumulatorSet
+             *
+             * @ingroup pubkey
+             *
+             * @tparam ProcessingMode a policy representing a work mode of the scheme
+             */
+            template<typename ProcessingMode>
+            using batch_verification_accumulator_set = boost::accumulators::accumulator_set<
+                typename ProcessingMode::result_type,
+                boost::accumulators::features<accumulators::tag::batch_verify<ProcessingMode>>>;
         }    // namespace pubkey
     }        // namespace crypto3
 }    // namespace nil
@@ -35,6 +35,7 @@
 #include <nil/crypto3/pubkey/algorithm/aggregate.hpp>
 #include <nil/crypto3/pubkey/algorithm/aggregate_verify.hpp>
 #include <nil/crypto3/pubkey/algorithm/aggregate_verify_single_msg.hpp>
+#include <nil/crypto3/pubkey/algorithm/batch_verify.hpp>
 
 #include <nil/crypto3/pubkey/bls.hpp>
 
@@ -66,6 +67,24 @@ void print_fp2_curve_group_element(std::ostream &os, const Fp2CurveGroupElement
        << e.Y.data[1].data << ") : (" << e.Z.data[0].data << " , " << e.Z.data[1].data << ")" << std::endl;
 }
 
+// A point of the curve outside the subgroup of prime order
+template<typename GroupValueType>
+GroupValueType off_subgroup_point() {
+    typedef typename GroupValueType::field_value_type field_value_type;
+    typedef typename GroupValueType::group_type::curve_type::scalar_field_type scalar_field_type;
+
+    GroupValueType point;
+    field_value_type x = field_value_type::one();
+    do {
+        x += field_value_type::one();
+        const field_value_type y2 = x.pow(3u) + field_value_type(GroupValueType::params_type::b);
+        if (y2.is_square()) {
+            point = GroupValueType(x, y2.sqrt(), field_value_type::one());
+        }
+    } while (!point.is_well_formed() || point.is_zero() || (point * scalar_field_type::modulus).is_zero());
+    return point;
+}
+
 namespace boost {
     namespace test_tools {
         namespace tt_detail {
@@ -471,6 +490,42 @@ void conformity_test(const std::vector<private_key<Scheme>> &sks,
 //    ::nil::crypto3::aggregate_verify<scheme_type>(agg_sig, agg_ver_acc);
     auto res = boost::accumulators::extract_result<aggregate_verification_acc>(agg_ver_acc);
     BOOST_CHECK_EQUAL(res, true);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Batch verify
+    using batch_verification_mode = typename ::nil::crypto3::pubkey::modes::isomorphic<scheme_type>::template bind<
+        ::nil::crypto3::pubkey::batch_verification_policy<Scheme>>::type;
+    using batch_verification_acc_set = batch_verification_accumulator_set<batch_verification_mode>;
+    using batch_verification_acc = typename boost::mpl::front<typename batch_verification_acc_set::features_type>::type;
+
+    std::vector<std::size_t> invalid = ::nil::crypto3::batch_verify<scheme_type>(msgs, sigs, sks);
+    BOOST_CHECK(invalid.empty());
+
+    std::vector<signature_type> wrong_sigs = sigs;
+    wrong_sigs.back() = wrong_sigs.front();
+    std::vector<std::size_t> wrong_invalid = ::nil::crypto3::batch_verify<scheme_type>(msgs, wrong_sigs, sks);
+    BOOST_CHECK(wrong_invalid == std::vector<std::size_t>({wrong_sigs.size() - 1}));
+
+    auto batch_ver_acc = batch_verification_acc_set();
+    for (std::size_t i = 0; i < sks.size(); ++i) {
+        const pubkey_type &key = sks[i];
+        if (i % 2) {
+            ::nil::crypto3::batch_verify<scheme_type>(msgs[i], wrong_sigs[i], key, batch_ver_acc);
+        } else {
+            ::nil::crypto3::batch_verify<scheme_type>(msgs[i].begin(), msgs[i].end(), wrong_sigs[i], key,
+                                                      batch_ver_acc);
+        }
+    }
+    auto acc_invalid = boost::accumulators::extract_result<batch_verification_acc>(batch_ver_acc);
+    BOOST_CHECK(acc_invalid == wrong_invalid);
+
+    // A valid signature plus a point outside the subgroup is on the curve, but outside the subgroup as well
+    std::vector<signature_type> off_subgroup_sigs = sigs;
+    off_subgroup_sigs.front() = off_subgroup_sigs.front() + off_subgroup_point<signature_type>();
+    BOOST_CHECK(off_subgroup_sigs.front().is_well_formed());
+    std::vector<std::size_t> off_subgroup_invalid =
+        ::nil::crypto3::batch_verify<scheme_type>(msgs, off_subgroup_sigs, sks);
+    BOOST_CHECK(off_subgroup_invalid == std::vector<std::size_t>({0}));
 }
 
 // TODO: add checks for wrong signatures
@@ -229,6 +229,14 @@ namespace nil {
                         _polys[index].insert(std::end(_polys[index]), std::begin(polys), std::end(polys));
                     }
 
+                    // Used when the polynomials preceding the batch contents are computed concurrently with them.
+                    template<typename container_type>
+                    void prepend_to_batch(std::size_t index, const container_type& polys){
+                        if( _locked.find(index) == _locked.end() ) _locked[index] = false;
+                        BOOST_ASSERT(!_locked[index]); // We cannot modify batch after commitment
+                        _polys[index].insert(std::begin(_polys[index]), std::begin(polys), std::end(polys));
+                    }
+
                     void append_eval_point(std::size_t batch_id, typename field_type::value_type point){
                         BOOST_ASSERT(_locked[batch_id]); // We can add points only after polynomails are commited.
                         for(std::size_t i = 0; i < _points[batch_id].size(); i++){
@@ -350,6 +350,31 @@ namespace nil {
                     return (x_index + domain_size / FRI::m) % domain_size;
                 }
 
+                /**
+                 * Offsets of the coset leaf of x_index: its values are the ones at (x_index + offset) % domain_size
+                 * and at the paired indices, offset running over the result in order. The pattern depends on the
+                 * domain only, so it is computed once for all the leaves.
+                 */
+                template<typename FRI>
+                static inline std::vector<std::size_t> get_coset_offsets(const std::size_t domain_size,
+                                                                         const std::size_t coset_size) {
+                    std::vector<std::size_t> offsets(coset_size / FRI::m);
+                    offsets[0] = 0;
+
+                    std::size_t base_index = domain_size / (FRI::m * FRI::m);
+                    std::size_t prev_half_size = 1;
+                    std::size_t i = 1;
+                    while (i < coset_size / FRI::m) {
+                        for (std::size_t j = 0; j < prev_half_size; j++) {
+                            offsets[i] = (base_index + offsets[j]) % domain_size;
+                            i++;
+                        }
+                        base_index /= FRI::m;
+                        prev_half_size <<= 1;
+                    }
+                    return offsets;
+                }
+
                 template<typename FRI,
                     typename std::enable_if<
                         std::is_base_of<
@@ -377,30 +402,17 @@ namespace nil {
                         detail::fri_field_element_consumer<FRI>(coset_size)
                     );
 
-                    for (std::size_t x_index = 0; x_index < leafs_number; x_index++) {
-                        std::vector<std::array<std::size_t, FRI::m>> s_indices(coset_size / FRI::m);
-                        s_indices[0][0] = x_index;
-                        s_indices[0][1] = get_paired_index<FRI>(x_index, domain_size);
+                    const std::vector<std::size_t> offsets = get_coset_offsets<FRI>(domain_size, coset_size);
 
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                    for (std::size_t x_index = 0; x_index < leafs_number; x_index++) {
                         auto& element_consumer = y_data[x_index].reset_cursor();
-                        element_consumer.consume(f[s_indices[0][0]]);
-                        element_consumer.consume(f[s_indices[0][1]]);
-
-                        std::size_t base_index = domain_size / (FRI::m * FRI::m);
-                        std::size_t prev_half_size = 1;
-                        std::size_t i = 1;
-                        while (i < coset_size / FRI::m) {
-                            for (std::size_t j = 0; j < prev_half_size; j++) {
-                                s_indices[i][0] = (base_index + s_indices[j][0]) % domain_size;
-                                s_indices[i][1] = get_paired_index<FRI>(s_indices[i][0], domain_size);
-
-                                element_consumer.consume(f[s_indices[i][0]]);
-                                element_consumer.consume(f[s_indices[i][1]]);
-
-                                i++;
-                            }
-                            base_index /= FRI::m;
-                            prev_half_size <<= 1;
+                        for (std::size_t offset : offsets) {
+                            const std::size_t index = (x_index + offset) % domain_size;
+                            element_consumer.consume(f[index]);
+                            element_consumer.consume(f[get_paired_index<FRI>(index, domain_size)]);
                         }
                     }
 
@@ -463,30 +475,18 @@ namespace nil {
                         detail::fri_field_element_consumer<FRI>(coset_size * list_size)
                     );
 
+                    const std::vector<std::size_t> offsets = get_coset_offsets<FRI>(domain_size, coset_size);
+
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
                     for (std::size_t x_index = 0; x_index < leafs_number; x_index++) {
                         auto& element_consumer = y_data[x_index].reset_cursor();
                         for (std::size_t polynom_index = 0; polynom_index < list_size; polynom_index++) {
-                            std::vector<std::array<std::size_t, FRI::m>> s_indices(coset_size / FRI::m);
-                            s_indices[0][0] = x_index;
-                            s_indices[0][1] = get_paired_index<FRI>(x_index, domain_size);
-
-                            element_consumer.consume(poly[polynom_index][s_indices[0][0]]);
-                            element_consumer.consume(poly[polynom_index][s_indices[0][1]]);
-
-                            std::size_t base_index = domain_size / (FRI::m * FRI::m);
-                            std::size_t prev_half_size = 1;
-                            std::size_t i = 1;
-                            while (i < coset_size / FRI::m) {
-                                for (std::size_t j = 0; j < prev_half_size; j++) {
-                                    s_indices[i][0] = (base_index + s_indices[j][0]) % domain_size;
-                                    s_indices[i][1] = get_paired_index<FRI>(s_indices[i][0], domain_size);
-                                    element_consumer.consume(poly[polynom_index][s_indices[i][0]]);
-                                    element_consumer.consume(poly[polynom_index][s_indices[i][1]]);
-
-                                    i++;
-                                }
-                                base_index /= FRI::m;
-                                prev_half_size <<= 1;
+                            for (std::size_t offset : offsets) {
+                                const std::size_t index = (x_index + offset) % domain_size;
+                                element_consumer.consume(poly[polynom_index][index]);
+                                element_consumer.consume(poly[polynom_index][get_paired_index<FRI>(index, domain_size)]);
                             }
                         }
                     }
@@ -763,7 +763,7 @@ namespace nil {
                                 if (poly.size() != fri_params.D[0]->size()) {
                                     if (d_cache.find(poly.size()) == d_cache.end()) {
                                         d_cache[poly.size()] =
-                                            math::make_evaluation_domain<typename FRI::field_type>(poly.size());
+                                            math::get_cached_evaluation_domain<typename FRI::field_type>(poly.size());
                                     }
                                     g_coeffs[key].emplace_back(poly.coefficients(d_cache[poly.size()]));
                                 } else {
@@ -76,6 +76,10 @@ namespace nil {
                             return element_kc(this->g + other.g, this->h + other.h);
                         }
 
+                        element_kc operator-() const {
+                            return element_kc(-this->g, -this->h);
+                        }
+
                         element_kc mixed_add(const element_kc &other) const {
                             return element_kc(this->g.mixed_add(other.g), this->h.mixed_add(other.h));
                         }
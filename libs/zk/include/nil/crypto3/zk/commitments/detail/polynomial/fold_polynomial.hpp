@@ -27,6 +27,12 @@
 #ifndef CRYPTO3_ZK_COMMITMENTS_DETAIL_FOLD_POLYNOMIAL_HPP
 #define CRYPTO3_ZK_COMMITMENTS_DETAIL_FOLD_POLYNOMIAL_HPP
 
+#include <algorithm>
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
 #include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
 
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
@@ -75,18 +81,33 @@ namespace nil {
                         // codeword = [two.inverse() * ( (one + alpha / (offset * (omega^i)) ) * codeword[i]
                         //  + (one - alpha / (offset * (omega^i)) ) * codeword[len(codeword)//2 + i] ) for i in
                         //  range(len(codeword)//2)]
+                        const std::size_t half_size = domain->size() / 2;
                         math::polynomial_dfs<typename FieldType::value_type> f_folded(
-                                domain->size() / 2 - 1, domain->size() / 2, FieldType::value_type::zero());
+                                half_size - 1, half_size, FieldType::value_type::zero());
 
                         typename FieldType::value_type two_inversed = 2u;
                         two_inversed = two_inversed.inversed();
                         typename FieldType::value_type omega_inversed = domain->get_domain_element(domain->size() - 1);
 
-                        typename FieldType::value_type acc = alpha;
-
-                        for (std::size_t i = 0; i <= f_folded.degree(); i++) {
-                            f_folded[i] = two_inversed * ((1u + acc) * f[i] + (1u - acc) * f[domain->size() / 2 + i]);
-                            acc *= omega_inversed;
+                        // The same as above with one multiplication less:
+                        // f_folded[i] = (f[i] + f[half_size + i]) / 2 + alpha * omega^-i * (f[i] - f[half_size + i]) / 2.
+                        // Each chunk starts from its own power of omega^-1, so the chunks are independent.
+#ifdef MULTICORE
+                        const std::size_t chunks = std::min<std::size_t>(omp_get_max_threads(), half_size);
+#else
+                        const std::size_t chunks = 1;
+#endif
+
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static, 1)
+#endif
+                        for (std::size_t c = 0; c < chunks; c++) {
+                            const std::size_t begin = half_size * c / chunks, end = half_size * (c + 1) / chunks;
+                            typename FieldType::value_type acc = alpha * two_inversed * omega_inversed.pow(begin);
+                            for (std::size_t i = begin; i < end; i++) {
+                                f_folded[i] = two_inversed * (f[i] + f[half_size + i]) + acc * (f[i] - f[half_size + i]);
+                                acc *= omega_inversed;
+                            }
                         }
 
                         return f_folded;
@@ -27,6 +27,8 @@
 
 #include <vector>
 
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+
 #include <nil/crypto3/zk/commitments/detail/polynomial/powers_of_tau/private_key.hpp>
 
 namespace nil {
@@ -87,18 +89,12 @@ namespace nil {
                         }
 
                         void transform(const private_key_type &key) {
-                            std::vector<field_value_type> taupowers;
-
-                            // Construct exponents
-                            // This could be parallelized
-                            auto acc = field_value_type::one();
-                            for (std::size_t i = 0; i < tau_powers_g1_length; ++i) {
-                                // taupowers[i] = tau^i
-                                taupowers.emplace_back(acc);
-                                acc *= key.tau;
-                            }
+                            // taupowers[i] = tau^i
+                            const std::vector<field_value_type> taupowers =
+                                algebra::batch_powers(key.tau, tau_powers_g1_length);
 
-                            // naive exp, could be parallelized
+                            // The bases are the powers of the previous contribution rather than a fixed generator,
+                            // so every point is multiplied on its own, in parallel
                             naive_batch_exp(
                                     tau_powers_g1.begin(), tau_powers_g1.end(), taupowers.begin(), taupowers.end());
 
@@ -118,6 +114,11 @@ namespace nil {
                                                        key.beta);
 
                             beta_g2 = beta_g2 * key.beta;
+
+                            algebra::batch_normalize<g1_type>(tau_powers_g1);
+                            algebra::batch_normalize<g2_type>(tau_powers_g2);
+                            algebra::batch_normalize<g1_type>(alpha_tau_powers_g1);
+                            algebra::batch_normalize<g1_type>(beta_tau_powers_g1);
                         }
 
                     private:
@@ -128,12 +129,12 @@ namespace nil {
                                              const ScalarIterator &pow_end) {
                             BOOST_ASSERT(std::distance(bases_begin, bases_end) <= std::distance(pow_begin, pow_end));
 
-                            auto base_iter = bases_begin;
-                            auto pow_iter = pow_begin;
-                            while (base_iter < bases_end) {
-                                *base_iter = *pow_iter * *base_iter;
-                                ++base_iter;
-                                ++pow_iter;
+                            const std::size_t n = std::distance(bases_begin, bases_end);
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                            for (std::size_t i = 0; i < n; ++i) {
+                                bases_begin[i] = pow_begin[i] * bases_begin[i];
                             }
                         }
 
@@ -145,12 +146,12 @@ namespace nil {
                                                         const field_value_type &coeff) {
                             BOOST_ASSERT(std::distance(bases_begin, bases_end) <= std::distance(pow_begin, pow_end));
 
-                            auto base_iter = bases_begin;
-                            auto pow_iter = pow_begin;
-                            while (base_iter < bases_end) {
-                                *base_iter = (coeff * *pow_iter) * *base_iter;
-                                ++base_iter;
-                                ++pow_iter;
+                            const std::size_t n = std::distance(bases_begin, bases_end);
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                            for (std::size_t i = 0; i < n; ++i) {
+                                bases_begin[i] = (coeff * pow_begin[i]) * bases_begin[i];
                             }
                         }
                     };
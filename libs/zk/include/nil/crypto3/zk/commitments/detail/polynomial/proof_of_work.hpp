@@ -28,7 +28,10 @@
 
 #include <boost/property_tree/ptree.hpp>
 
+#include <atomic>
 #include <cstdint>
+#include <type_traits>
+#include <utility>
 
 #include <nil/crypto3/random/algebraic_engine.hpp>
 #include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
@@ -38,6 +41,102 @@ namespace nil {
     namespace crypto3 {
         namespace zk {
             namespace commitments {
+                namespace detail {
+                    // Amount of nonces checked at once by all the threads.
+                    constexpr std::size_t proof_of_work_block_size = 4096;
+
+                    /**
+                     * Returns the first nonce start, start + 1, ... accepted by a checker. The nonces are checked
+                     * by blocks which are split between the threads, each thread gets its own checker from
+                     * make_checker. A thread skips the nonces of the block following an already found one, so
+                     * the result does not depend on the threads count.
+                     */
+                    template<typename NonceType, typename CheckerFactory>
+                    NonceType find_proof_of_work(const NonceType &start, const CheckerFactory &make_checker) {
+                        const NonceType block_size(proof_of_work_block_size);
+                        for (NonceType block_begin = start;; block_begin = block_begin + block_size) {
+                            std::atomic<std::size_t> found(proof_of_work_block_size);
+#ifdef MULTICORE
+#pragma omp parallel
+#endif
+                            {
+                                auto is_valid = make_checker();
+#ifdef MULTICORE
+#pragma omp for schedule(dynamic, 64)
+#endif
+                                for (std::size_t i = 0; i < proof_of_work_block_size; ++i) {
+                                    if (i > found.load(std::memory_order_relaxed) ||
+                                        !is_valid(block_begin + NonceType(i))) {
+                                        continue;
+                                    }
+                                    std::size_t current = found.load(std::memory_order_relaxed);
+                                    while (i < current && !found.compare_exchange_weak(current, i)) {
+                                    }
+                                }
+                            }
+                            if (found != proof_of_work_block_size) {
+                                return block_begin + NonceType(found);
+                            }
+                        }
+                    }
+
+                    template<typename Transcript, typename = void>
+                    struct has_absorbed_state : std::false_type { };
+
+                    template<typename Transcript>
+                    struct has_absorbed_state<
+                        Transcript, std::void_t<decltype(std::declval<const Transcript &>().absorbed_state())>>
+                        : std::true_type { };
+
+                    /**
+                     * A transcript snapshot absorbing one nonce at a time, every nonce goes to the same state.
+                     * Sponge based transcripts keep the whole absorbed state in the sponge, so the snapshot is a
+                     * copy of the sponge restored before each nonce.
+                     */
+                    template<typename Transcript, typename Enable = void>
+                    class proof_of_work_snapshot {
+                    public:
+                        explicit proof_of_work_snapshot(const Transcript &transcript) :
+                            snapshot(transcript), current(transcript) {
+                        }
+
+                        template<typename Nonce>
+                        Transcript &absorb(const Nonce &nonce) {
+                            current = snapshot;
+                            current(nonce);
+                            return current;
+                        }
+
+                    private:
+                        const Transcript &snapshot;
+                        Transcript current;
+                    };
+
+                    /**
+                     * Transcripts over a plain hash rebuild the hash accumulator from their digest on every
+                     * absorption. The snapshot keeps that accumulator, so a nonce costs only its own bytes and
+                     * the finalization.
+                     */
+                    template<typename Transcript>
+                    class proof_of_work_snapshot<Transcript,
+                                                 typename std::enable_if_t<has_absorbed_state<Transcript>::value>> {
+                    public:
+                        explicit proof_of_work_snapshot(const Transcript &transcript) :
+                            snapshot(transcript.absorbed_state()), current(transcript) {
+                        }
+
+                        template<typename Nonce>
+                        Transcript &absorb(const Nonce &nonce) {
+                            current.absorb_from(snapshot, nonce);
+                            return current;
+                        }
+
+                    private:
+                        const decltype(std::declval<const Transcript &>().absorbed_state()) snapshot;
+                        Transcript current;
+                    };
+                }    // namespace detail
+
                 template<typename TranscriptHashType, typename OutType = std::uint32_t>
                 class proof_of_work {
                 public:
@@ -56,21 +155,27 @@ namespace nil {
                         }
 
                     static inline OutType generate(transcript_type &transcript, std::size_t GrindingBits = 16) {
+                        return generate(transcript, GrindingBits, std::rand());
+                    }
+
+                    // Finds the first suitable nonce starting from start_nonce.
+                    static inline OutType generate(transcript_type &transcript, std::size_t GrindingBits,
+                                                   output_type start_nonce) {
                         BOOST_ASSERT_MSG(GrindingBits < 64, "Grinding parameter should be bits, not mask");
-                        output_type mask = GrindingBits > 0 ? ( 1ULL << GrindingBits ) - 1 : 0;
-                        output_type proof_of_work = std::rand();
-                        output_type result;
-
-                        while( true ) {
-                            transcript_type tmp_transcript = transcript;
-                            tmp_transcript(to_byte_array(proof_of_work));
-                            result = tmp_transcript.template int_challenge<output_type>();
-                            if ((result & mask) == 0)
-                                break;
-                            proof_of_work++;
-                        }
+                        const output_type mask = GrindingBits > 0 ? ( 1ULL << GrindingBits ) - 1 : 0;
+
+                        // The absorbed state is snapshotted once per thread, the caller's transcript is not modified.
+                        const transcript_type &source = transcript;
+                        output_type proof_of_work = detail::find_proof_of_work(start_nonce, [&source, mask]() {
+                            return [snapshot = detail::proof_of_work_snapshot<transcript_type>(source),
+                                    mask](output_type nonce) mutable {
+                                return (snapshot.absorb(to_byte_array(nonce)).template int_challenge<output_type>() &
+                                        mask) == 0;
+                            };
+                        });
+
                         transcript(to_byte_array(proof_of_work));
-                        result = transcript.template int_challenge<output_type>();
+                        transcript.template int_challenge<output_type>();
                         return proof_of_work;
                     }
 
@@ -98,24 +203,30 @@ namespace nil {
                     static inline value_type generate(transcript_type &transcript, std::size_t GrindingBits = 16) {
                         static boost::random::random_device dev;
                         static nil::crypto3::random::algebraic_engine<FieldType> random_engine(dev);
-                        value_type proof_of_work = random_engine();
-                        integral_type result;
+                        return generate(transcript, GrindingBits, random_engine());
+                    }
 
-                        integral_type mask =
+                    // Finds the first suitable nonce starting from start_nonce.
+                    static inline value_type generate(transcript_type &transcript, std::size_t GrindingBits,
+                                                      const value_type &start_nonce) {
+                        const integral_type mask =
                             (GrindingBits > 0 ?
                                 ((integral_type(1) << GrindingBits) - 1) << (FieldType::modulus_bits - GrindingBits)
                                 : 0);
 
-                        while( true ) {
-                            transcript_type tmp_transcript = transcript;
-                            tmp_transcript(proof_of_work);
-                            result = integral_type(tmp_transcript.template challenge<FieldType>().data);
-                            if ((result & mask) == 0)
-                                break;
-                            proof_of_work++;
-                        }
+                        // The absorbed state is snapshotted once per thread, the caller's transcript is not modified.
+                        const transcript_type &source = transcript;
+                        value_type proof_of_work = detail::find_proof_of_work(start_nonce, [&source, &mask]() {
+                            return [snapshot = detail::proof_of_work_snapshot<transcript_type>(source),
+                                    &mask](const value_type &nonce) mutable {
+                                integral_type result =
+                                    integral_type(snapshot.absorb(nonce).template challenge<FieldType>().data);
+                                return (result & mask) == 0;
+                            };
+                        });
+
                         transcript(proof_of_work);
-                        result = integral_type(transcript.template challenge<FieldType>().data);
+                        transcript.template challenge<FieldType>();
                         return proof_of_work;
                     }
 
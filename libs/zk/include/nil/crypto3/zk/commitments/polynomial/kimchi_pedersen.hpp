@@ -53,7 +53,7 @@ namespace nil {
                     typedef typename CurveType::base_field_type base_field_type;
                     typedef typename CurveType::template g1_type<algebra::curves::coordinates::affine> group_type;
 
-                    typedef algebra::policies::multiexp_method_BDLO12 multiexp_method;
+                    typedef algebra::policies::multiexp_method_pippenger multiexp_method;
 
                     typedef zk::transcript::DefaultFqSponge<CurveType> sponge_type;
                     typedef snark::group_map<CurveType> group_map_type;
@@ -29,6 +29,7 @@
 #ifndef CRYPTO3_ZK_COMMITMENTS_KZG_HPP
 #define CRYPTO3_ZK_COMMITMENTS_KZG_HPP
 
+#include <memory>
 #include <tuple>
 #include <vector>
 #include <set>
@@ -42,6 +43,7 @@
 #include <nil/crypto3/math/polynomial/lagrange_interpolation.hpp>
 #include <nil/crypto3/algebra/type_traits.hpp>
 #include <nil/crypto3/algebra/algorithms/pair.hpp>
+#include <nil/crypto3/algebra/multiexp/fixed_base_multiexp.hpp>
 #include <nil/crypto3/algebra/multiexp/multiexp.hpp>
 #include <nil/crypto3/algebra/multiexp/policies.hpp>
 #include <nil/crypto3/algebra/curves/detail/marshalling.hpp>
@@ -78,7 +80,7 @@ namespace nil {
                     typedef CurveType curve_type;
                     typedef typename curve_type::gt_type::value_type gt_value_type;
 
-                    using multiexp_method = typename algebra::policies::multiexp_method_BDLO12;
+                    using multiexp_method = typename algebra::policies::multiexp_method_pippenger;
                     using field_type = typename curve_type::scalar_field_type;
                     using scalar_value_type = typename curve_type::scalar_field_type::value_type;
                     using single_commitment_type = std::vector<typename curve_type::template g1_type<>::value_type>;
@@ -97,29 +99,29 @@ namespace nil {
 
                         params_type() {}
 
-                        params_type(std::size_t d) {
-                            auto alpha = algebra::random_element<field_type>();
-                            verification_key = verification_key_type::one() * alpha;
-                            commitment_key.resize(d);
-                            auto alpha_com = commitment_type::one();
-                            for (std::size_t i = 0; i < d; i++) {
-                                commitment_key[i] = alpha_com;
-                                alpha_com = alpha * alpha_com;
-                            }
-                        }
+                        params_type(std::size_t d) : params_type(d, algebra::random_element<field_type>()) {}
 
                         params_type(std::size_t d, scalar_value_type alpha) {
                             verification_key = verification_key_type::one() * alpha;
-                            commitment_key.resize(d);
-                            auto alpha_com = commitment_type::one();
-                            for (std::size_t i = 0; i < d; i++) {
-                                commitment_key[i] = alpha_com;
-                                alpha_com = alpha * alpha_com;
-                            }
+                            commitment_key = algebra::batch_exp_powers<typename curve_type::template g1_type<>,
+                                                                       field_type>(commitment_type::one(), alpha, d);
                         }
 
                         params_type(single_commitment_type ck, verification_key_type vk) :
                                 commitment_key(ck), verification_key(vk) {}
+
+                        /**
+                         * Optional fixed-base multiexp table of commitment_key, used by commit when present.
+                         * It is built by precompute_commitment_key_table or read by
+                         * marshalling::types::make_fixed_base_multiexp_table, it is not a part of marshalled params.
+                         */
+                        std::shared_ptr<const algebra::fixed_base_multiexp_table<commitment_type>> commitment_key_table;
+
+                        void precompute_commitment_key_table(std::size_t memory_budget = 0) {
+                            commitment_key_table = std::make_shared<algebra::fixed_base_multiexp_table<commitment_type>>(
+                                algebra::make_fixed_base_multiexp_table(commitment_key.begin(), commitment_key.end(),
+                                                                        field_type::modulus_bits, memory_budget));
+                        }
                     };
 
                     struct public_key_type {
@@ -147,6 +149,9 @@ namespace nil {
                 commit(const typename CommitmentSchemeType::params_type &params,
                        const typename math::polynomial<typename CommitmentSchemeType::scalar_value_type> &f) {
                     BOOST_ASSERT(f.size() <= params.commitment_key.size());
+                    if (params.commitment_key_table) {
+                        return algebra::fixed_base_multiexp(*params.commitment_key_table, f.begin(), f.end());
+                    }
                     return algebra::multiexp<typename CommitmentSchemeType::multiexp_method>(
                             params.commitment_key.begin(),
                             params.commitment_key.begin() + f.size(),
@@ -242,7 +247,7 @@ namespace nil {
                     typedef TranscriptHashType transcript_hash_type;
                     typedef typename curve_type::gt_type::value_type gt_value_type;
 
-                    using multiexp_method = typename algebra::policies::multiexp_method_BDLO12;
+                    using multiexp_method = typename algebra::policies::multiexp_method_pippenger;
                     using field_type = typename curve_type::scalar_field_type;
                     using scalar_value_type = typename curve_type::scalar_field_type::value_type;
                     using single_commitment_type = typename curve_type::template g1_type<>::value_type;
@@ -273,35 +278,16 @@ namespace nil {
 
                         params_type() {};
 
-                        params_type(std::size_t d, std::size_t t) {
-                            auto alpha = algebra::random_element<typename curve_type::scalar_field_type>();
-                            commitment_key.resize(d);
-                            verification_key.resize(t + 1);
-                            auto alpha_comm = single_commitment_type::one();
-                            for (std::size_t i = 0; i < d; ++i) {
-                                commitment_key[i] = alpha_comm;
-                                alpha_comm *= alpha;
-                            }
-                            auto alpha_ver = verification_key_type::one();
-                            for (std::size_t i = 0; i <= t; ++i) {
-                                verification_key[i] = alpha_ver;
-                                alpha_ver *= alpha;
-                            }
-                        }
+                        params_type(std::size_t d, std::size_t t) :
+                            params_type(d, t, algebra::random_element<typename curve_type::scalar_field_type>()) {}
 
                         params_type(std::size_t d, std::size_t t, scalar_value_type alpha) {
-                            commitment_key.resize(d);
-                            verification_key.resize(t + 1);
-                            auto alpha_comm = single_commitment_type::one();
-                            for (std::size_t i = 0; i < d; ++i) {
-                                commitment_key[i] = alpha_comm;
-                                alpha_comm = alpha * alpha_comm;
-                            }
-                            auto alpha_ver = verification_key_type::one();
-                            for (std::size_t i = 0; i <= t; ++i) {
-                                verification_key[i] = alpha_ver;
-                                alpha_ver = alpha * alpha_ver;
-                            }
+                            commitment_key =
+                                algebra::batch_exp_powers<typename curve_type::template g1_type<>, field_type>(
+                                    single_commitment_type::one(), alpha, d);
+                            verification_key =
+                                algebra::batch_exp_powers<typename curve_type::template g2_type<>, field_type>(
+                                    verification_key_type::one(), alpha, t + 1);
                         }
 
                         params_type(std::vector<single_commitment_type> commitment_key,
@@ -311,8 +297,25 @@ namespace nil {
                         params_type operator=(const params_type &other) {
                             commitment_key = other.commitment_key;
                             verification_key = other.verification_key;
+                            commitment_key_table = other.commitment_key_table;
                             return *this;
                         }
+
+                        /**
+                         * Optional fixed-base multiexp table of commitment_key, used by commit_one when present.
+                         * It is built by precompute_commitment_key_table or read by
+                         * marshalling::types::make_fixed_base_multiexp_table, it is not a part of marshalled params.
+                         */
+                        std::shared_ptr<const algebra::fixed_base_multiexp_table<single_commitment_type>>
+                            commitment_key_table;
+
+                        void precompute_commitment_key_table(std::size_t memory_budget = 0) {
+                            commitment_key_table =
+                                std::make_shared<algebra::fixed_base_multiexp_table<single_commitment_type>>(
+                                    algebra::make_fixed_base_multiexp_table(commitment_key.begin(),
+                                                                            commitment_key.end(),
+                                                                            field_type::modulus_bits, memory_budget));
+                        }
                     };
 
                     struct public_key_type {
@@ -404,6 +407,9 @@ namespace nil {
                 commit_one(const typename CommitmentSchemeType::params_type &params,
                            const typename math::polynomial<typename CommitmentSchemeType::field_type::value_type> &poly) {
                     BOOST_ASSERT(poly.size() <= params.commitment_key.size());
+                    if (params.commitment_key_table) {
+                        return algebra::fixed_base_multiexp(*params.commitment_key_table, poly.begin(), poly.end());
+                    }
                     return algebra::multiexp<typename CommitmentSchemeType::multiexp_method>(
                             params.commitment_key.begin(),
                             params.commitment_key.begin() + poly.size(),
@@ -422,6 +428,10 @@ namespace nil {
                         const typename math::polynomial_dfs<typename CommitmentSchemeType::field_type::value_type> &poly) {
                     auto poly_normal = poly.coefficients();
                     BOOST_ASSERT(poly_normal.size() <= params.commitment_key.size());
+                    if (params.commitment_key_table) {
+                        return algebra::fixed_base_multiexp(*params.commitment_key_table, poly_normal.begin(),
+                                                            poly_normal.end());
+                    }
                     return algebra::multiexp<typename CommitmentSchemeType::multiexp_method>(
                             params.commitment_key.begin(),
                             params.commitment_key.begin() +
@@ -607,7 +617,10 @@ namespace nil {
 
                     auto gamma = transcript.template challenge<typename CommitmentSchemeType::curve_type::scalar_field_type>();
                     auto factor = CommitmentSchemeType::scalar_value_type::one();
-                    auto left_side_pairing = CommitmentSchemeType::gt_value_type::one();
+
+                    // prod e(left_i, right_i) == e(proof, right) is checked with a single final exponentiation.
+                    std::vector<typename CommitmentSchemeType::single_commitment_type> pairing_g1;
+                    std::vector<typename CommitmentSchemeType::verification_key_type> pairing_g2;
 
                     for (std::size_t i = 0; i < public_key.commits.size(); ++i) {
                         auto r_commit = commit_one<CommitmentSchemeType>(params, public_key.r[i]);
@@ -618,18 +631,19 @@ namespace nil {
                         if (public_key.commits.size() == 1) {
                             assert(right == CommitmentSchemeType::verification_key_type::one());
                         }
-                        left_side_pairing =
-                                left_side_pairing *
-                                algebra::pair_reduced<typename CommitmentSchemeType::curve_type>(left, right);
+                        pairing_g1.emplace_back(left);
+                        pairing_g2.emplace_back(right);
                         factor = factor * gamma;
                     }
 
                     auto right = commit_g2<CommitmentSchemeType>(params, create_polynom_by_zeros<CommitmentSchemeType>(
                             public_key.T));
-                    auto right_side_pairing = algebra::pair_reduced<typename CommitmentSchemeType::curve_type>(proof,
-                                                                                                               right);
+                    pairing_g1.emplace_back(-proof);
+                    pairing_g2.emplace_back(right);
 
-                    return left_side_pairing == right_side_pairing;
+                    return algebra::multi_pair_reduced<typename CommitmentSchemeType::curve_type>(pairing_g1,
+                                                                                                  pairing_g2) ==
+                           CommitmentSchemeType::gt_value_type::one();
                 }
             } // namespace algorithms
 
@@ -821,7 +835,9 @@ namespace nil {
 
                         auto gamma = transcript.template challenge<typename CommitmentSchemeType::curve_type::scalar_field_type>();
                         auto factor = CommitmentSchemeType::scalar_value_type::one();
-                        auto left_side_accum = CommitmentSchemeType::gt_value_type::one();
+
+                        std::vector<typename curve_type::template g1_type<>::value_type> pairing_g1;
+                        std::vector<typename curve_type::template g2_type<>::value_type> pairing_g2;
 
                         for (const auto &it: this->_commitments) {
                             auto k = it.first;
@@ -844,20 +860,18 @@ namespace nil {
                                 auto diffpoly = set_difference_polynom(_merged_points, this->_points.at(k)[i]);
                                 auto diffpoly_commitment = commit_g2(diffpoly);
 
-                                auto left_side_pairing = nil::crypto3::algebra::pair_reduced<curve_type>(
-                                        factor * (i_th_commitment - U_commit), diffpoly_commitment);
-
-                                left_side_accum = left_side_accum * left_side_pairing;
+                                pairing_g1.emplace_back(factor * (i_th_commitment - U_commit));
+                                pairing_g2.emplace_back(diffpoly_commitment);
                                 factor *= gamma;
                             }
                         }
 
-                        auto right_side_pairing = algebra::pair_reduced<typename CommitmentSchemeType::curve_type>(
-                                proof.kzg_proof,
-                                commit_g2(this->get_V(this->_merged_points))
-                        );
+                        // The right side e(kzg_proof, V) joins the product negated, one final exponentiation.
+                        pairing_g1.emplace_back(-proof.kzg_proof);
+                        pairing_g2.emplace_back(commit_g2(this->get_V(this->_merged_points)));
 
-                        return left_side_accum == right_side_pairing;
+                        return algebra::multi_pair_reduced<curve_type>(pairing_g1, pairing_g2) ==
+                               CommitmentSchemeType::gt_value_type::one();
                     }
 
                     const params_type &get_commitment_params() const {
@@ -0,0 +1,351 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Compilation of an expression into a flat register program, which is then
+// evaluated on scalar variable values, e.g. row by row over the table columns.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_MATH_COMPILED_EXPRESSION_HPP
+#define CRYPTO3_ZK_MATH_COMPILED_EXPRESSION_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/variant/static_visitor.hpp>
+#include <boost/variant/apply_visitor.hpp>
+
+#include <nil/crypto3/zk/math/expression.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+
+            /**
+             * An expression compiled into a straight-line program over a register file.
+             *
+             * The registers are laid out as [variables | constants | temporaries]. The caller writes the
+             * values of variables() into the first registers and calls evaluate(), which runs the
+             * instructions and returns the value of the expression. Equal subexpressions are computed
+             * once, and the temporaries are reused once their value is not needed any more, so the
+             * register file stays small and may be kept per thread while running over many rows.
+             */
+            template<typename VariableType>
+            class compiled_expression {
+            public:
+                using variable_type = VariableType;
+                using value_type = typename VariableType::assignment_type;
+
+                enum class opcode : std::uint8_t { add, sub, mul };
+
+                struct instruction {
+                    opcode op;
+                    std::uint32_t dst;
+                    std::uint32_t lhs;
+                    std::uint32_t rhs;
+                };
+
+                explicit compiled_expression(const expression<VariableType> &expr) {
+                    compiler c(*this);
+                    c.compile(expr);
+                }
+
+                const std::vector<VariableType> &variables() const {
+                    return _variables;
+                }
+
+                const std::vector<instruction> &instructions() const {
+                    return _instructions;
+                }
+
+                std::size_t registers_count() const {
+                    return _registers_count;
+                }
+
+                // Creates a register file with the constants already in place.
+                std::vector<value_type> make_registers() const {
+                    std::vector<value_type> registers(_registers_count, value_type::zero());
+                    std::copy(_constants.begin(), _constants.end(), registers.begin() + _variables.size());
+                    return registers;
+                }
+
+                // Registers [0, variables().size()) must hold the values of variables().
+                const value_type &evaluate(std::vector<value_type> &registers) const {
+                    for (const instruction &ins : _instructions) {
+                        switch (ins.op) {
+                            case opcode::add:
+                                registers[ins.dst] = registers[ins.lhs] + registers[ins.rhs];
+                                break;
+                            case opcode::sub:
+                                registers[ins.dst] = registers[ins.lhs] - registers[ins.rhs];
+                                break;
+                            case opcode::mul:
+                                registers[ins.dst] = registers[ins.lhs] * registers[ins.rhs];
+                                break;
+                        }
+                    }
+                    return registers[_result];
+                }
+
+                /**
+                 * Degree of the expression as a polynomial, given the degrees of the variables. Additions
+                 * take the maximum and multiplications the sum, the same way the polynomial arithmetic does.
+                 */
+                template<typename VariableDegreeGetter>
+                std::size_t degree(VariableDegreeGetter get_variable_degree) const {
+                    std::vector<std::size_t> degrees(_registers_count, 0);
+                    for (std::size_t i = 0; i < _variables.size(); ++i) {
+                        degrees[i] = get_variable_degree(i);
+                    }
+                    for (const instruction &ins : _instructions) {
+                        degrees[ins.dst] = ins.op == opcode::mul ? degrees[ins.lhs] + degrees[ins.rhs] :
+                                                                   std::max(degrees[ins.lhs], degrees[ins.rhs]);
+                    }
+                    return degrees[_result];
+                }
+
+            private:
+                // Value references used while compiling, before the registers are assigned.
+                enum class operand_kind : std::uint8_t { variable, constant, temporary };
+
+                struct operand {
+                    operand_kind kind;
+                    std::uint32_t index;
+                };
+
+                struct ssa_instruction {
+                    opcode op;
+                    operand lhs;
+                    operand rhs;
+                };
+
+                class compiler : public boost::static_visitor<operand> {
+                public:
+                    compiler(compiled_expression &program) : _program(program) {
+                    }
+
+                    void compile(const expression<VariableType> &expr) {
+                        operand result = boost::apply_visitor(*this, expr.get_expr());
+                        allocate_registers(result);
+                    }
+
+                    operand operator()(const term<VariableType> &t) {
+                        if (t.get_vars().empty()) {
+                            return constant(t.get_coeff());
+                        }
+                        auto cached = find(_terms, t);
+                        if (cached.first) {
+                            return cached.second;
+                        }
+
+                        const auto &vars = t.get_vars();
+                        operand result = variable(vars[0]);
+                        for (std::size_t i = 1; i < vars.size(); ++i) {
+                            result = emit(opcode::mul, result, variable(vars[i]));
+                        }
+                        if (!t.get_coeff().is_one()) {
+                            result = emit(opcode::mul, constant(t.get_coeff()), result);
+                        }
+                        _terms.emplace(t.get_hash(), std::make_pair(&t, result));
+                        return result;
+                    }
+
+                    operand operator()(const pow_operation<VariableType> &pow) {
+                        auto cached = find(_pows, pow);
+                        if (cached.first) {
+                            return cached.second;
+                        }
+
+                        operand base = boost::apply_visitor(*this, pow.get_expr().get_expr());
+                        operand result;
+                        int power = pow.get_power();
+                        if (power == 0) {
+                            result = constant(value_type::one());
+                        } else {
+                            // Left-to-right binary exponentiation.
+                            int bit = 0;
+                            while ((power >> (bit + 1)) != 0) {
+                                ++bit;
+                            }
+                            result = base;
+                            for (--bit; bit >= 0; --bit) {
+                                result = emit(opcode::mul, result, result);
+                                if ((power >> bit) & 1) {
+                                    result = emit(opcode::mul, result, base);
+                                }
+                            }
+                        }
+                        _pows.emplace(pow.get_hash(), std::make_pair(&pow, result));
+                        return result;
+                    }
+
+                    operand operator()(const binary_arithmetic_operation<VariableType> &op) {
+                        auto cached = find(_operations, op);
+                        if (cached.first) {
+                            return cached.second;
+                        }
+
+                        operand lhs = boost::apply_visitor(*this, op.get_expr_left().get_expr());
+                        operand rhs = boost::apply_visitor(*this, op.get_expr_right().get_expr());
+                        operand result;
+                        switch (op.get_op()) {
+                            case ArithmeticOperator::ADD:
+                                result = emit(opcode::add, lhs, rhs);
+                                break;
+                            case ArithmeticOperator::SUB:
+                                result = emit(opcode::sub, lhs, rhs);
+                                break;
+                            case ArithmeticOperator::MULT:
+                                result = emit(opcode::mul, lhs, rhs);
+                                break;
+                        }
+                        _operations.emplace(op.get_hash(), std::make_pair(&op, result));
+                        return result;
+                    }
+
+                private:
+                    // Subexpressions are looked up by the hash and compared by the nodes of the compiled
+                    // expression, which outlives the compilation, so the subtrees are never copied.
+                    template<typename NodeType>
+                    using node_cache = std::unordered_multimap<std::size_t, std::pair<const NodeType *, operand>>;
+
+                    template<typename NodeType>
+                    static std::pair<bool, operand> find(const node_cache<NodeType> &cache, const NodeType &node) {
+                        auto range = cache.equal_range(node.get_hash());
+                        for (auto it = range.first; it != range.second; ++it) {
+                            if (*it->second.first == node) {
+                                return {true, it->second.second};
+                            }
+                        }
+                        return {false, operand()};
+                    }
+
+                    operand variable(const VariableType &var) {
+                        auto it = _variable_ids.find(var);
+                        if (it != _variable_ids.end()) {
+                            return {operand_kind::variable, it->second};
+                        }
+                        std::uint32_t id = _program._variables.size();
+                        _program._variables.push_back(var);
+                        _variable_ids.emplace(var, id);
+                        return {operand_kind::variable, id};
+                    }
+
+                    operand constant(const value_type &value) {
+                        auto it = std::find(_program._constants.begin(), _program._constants.end(), value);
+                        std::uint32_t id = std::distance(_program._constants.begin(), it);
+                        if (it == _program._constants.end()) {
+                            _program._constants.push_back(value);
+                        }
+                        return {operand_kind::constant, id};
+                    }
+
+                    operand emit(opcode op, operand lhs, operand rhs) {
+                        _code.push_back({op, lhs, rhs});
+                        return {operand_kind::temporary, static_cast<std::uint32_t>(_code.size() - 1)};
+                    }
+
+                    // Assigns the registers to the temporaries with a linear scan: the register of a
+                    // temporary is released at its last use and may be the destination of that instruction.
+                    void allocate_registers(operand result) {
+                        constexpr std::size_t never = std::numeric_limits<std::size_t>::max();
+
+                        std::vector<std::size_t> last_use(_code.size(), 0);
+                        for (std::size_t i = 0; i < _code.size(); ++i) {
+                            for (const operand &arg : {_code[i].lhs, _code[i].rhs}) {
+                                if (arg.kind == operand_kind::temporary) {
+                                    last_use[arg.index] = i;
+                                }
+                            }
+                        }
+                        if (result.kind == operand_kind::temporary) {
+                            last_use[result.index] = never;
+                        }
+
+                        const std::uint32_t first_temporary = _program._variables.size() + _program._constants.size();
+                        std::vector<std::uint32_t> temporary_registers(_code.size());
+                        std::vector<std::uint32_t> free_registers;
+                        std::uint32_t registers_count = first_temporary;
+
+                        auto register_of = [&](const operand &arg) -> std::uint32_t {
+                            switch (arg.kind) {
+                                case operand_kind::variable:
+                                    return arg.index;
+                                case operand_kind::constant:
+                                    return _program._variables.size() + arg.index;
+                                default:
+                                    return temporary_registers[arg.index];
+                            }
+                        };
+
+                        _program._instructions.reserve(_code.size());
+                        for (std::size_t i = 0; i < _code.size(); ++i) {
+                            const ssa_instruction &ins = _code[i];
+                            std::uint32_t lhs = register_of(ins.lhs);
+                            std::uint32_t rhs = register_of(ins.rhs);
+                            for (const operand &arg : {ins.lhs, ins.rhs}) {
+                                if (arg.kind == operand_kind::temporary && last_use[arg.index] == i) {
+                                    free_registers.push_back(temporary_registers[arg.index]);
+                                    // Both operands may be the same temporary.
+                                    last_use[arg.index] = never;
+                                }
+                            }
+                            std::uint32_t dst;
+                            if (free_registers.empty()) {
+                                dst = registers_count++;
+                            } else {
+                                dst = free_registers.back();
+                                free_registers.pop_back();
+                            }
+                            temporary_registers[i] = dst;
+                            _program._instructions.push_back({ins.op, dst, lhs, rhs});
+                        }
+
+                        _program._result = register_of(result);
+                        _program._registers_count = registers_count;
+                    }
+
+                    compiled_expression &_program;
+
+                    std::vector<ssa_instruction> _code;
+                    std::unordered_map<VariableType, std::uint32_t> _variable_ids;
+
+                    node_cache<term<VariableType>> _terms;
+                    node_cache<pow_operation<VariableType>> _pows;
+                    node_cache<binary_arithmetic_operation<VariableType>> _operations;
+                };
+
+                std::vector<VariableType> _variables;
+                std::vector<value_type> _constants;
+                std::vector<instruction> _instructions;
+                std::uint32_t _result = 0;
+                std::size_t _registers_count = 0;
+            };
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_MATH_COMPILED_EXPRESSION_HPP
@@ -69,7 +69,7 @@ namespace nil {
                                  res.degree() + val.degree() + 1}));
                         for (auto domain_size : {res_domain_size, val_domain_size, new_domain_size}) {
                             if (domains.find(domain_size) == domains.end()) {
-                                domains[domain_size] = make_evaluation_domain<FieldType>(domain_size);
+                                domains[domain_size] = get_cached_evaluation_domain<FieldType>(domain_size);
                             }
                         }
                         res.cached_multiplication(
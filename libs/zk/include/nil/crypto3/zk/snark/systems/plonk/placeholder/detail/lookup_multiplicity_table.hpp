@@ -0,0 +1,175 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Declaration of the multiplicity table used to sort lookup columns.
+//
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PLONK_PLACEHOLDER_LOOKUP_MULTIPLICITY_TABLE_HPP
+#define CRYPTO3_PLONK_PLACEHOLDER_LOOKUP_MULTIPLICITY_TABLE_HPP
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+                namespace detail {
+                    /**
+                     * Open addressing hash table counting how many times each value of the lookup tables occurs
+                     * in the table and input columns.
+                     *
+                     * Keys and counts live in flat arrays sized once from the table columns, so counting does
+                     * not allocate per value. Counting runs in parallel over all the cells of all the columns,
+                     * the threads increment the shared counts atomically, so no per-thread copies are made.
+                     */
+                    template<typename FieldType>
+                    class lookup_multiplicity_table {
+                    public:
+                        typedef typename FieldType::value_type value_type;
+                        typedef math::polynomial_dfs<value_type> polynomial_dfs_type;
+
+                        constexpr static const std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+                        /**
+                         * Inserts the values of the first rows_amount rows of the table columns, each with
+                         * the number of cells it takes.
+                         */
+                        lookup_multiplicity_table(const std::vector<polynomial_dfs_type> &table_columns,
+                                                  std::size_t rows_amount) :
+                            rows_amount(rows_amount) {
+                            // Repeated values of a table are placed one under another, so the number of runs
+                            // bounds the number of distinct values.
+                            std::size_t runs = 0;
+                            for (std::size_t i = 0; i < table_columns.size(); i++) {
+                                for (std::size_t j = 0; j < rows_amount; j++) {
+                                    if (j == 0 || table_columns[i][j] != table_columns[i][j - 1]) {
+                                        runs++;
+                                    }
+                                }
+                            }
+
+                            // Load factor at most 1/2
+                            log_capacity = 1;
+                            while ((std::size_t(1) << log_capacity) < 2 * runs) {
+                                log_capacity++;
+                            }
+                            keys.resize(std::size_t(1) << log_capacity);
+                            occupied.assign(keys.size(), false);
+                            counts.assign(keys.size(), 0);
+
+                            for (std::size_t i = 0; i < table_columns.size(); i++) {
+                                for (std::size_t j = 0; j < rows_amount; j++) {
+                                    if (j == 0 || table_columns[i][j] != table_columns[i][j - 1]) {
+                                        insert(table_columns[i][j]);
+                                    }
+                                }
+                            }
+                            add(table_columns);
+                        }
+
+                        /**
+                         * Counts the values of the first rows_amount rows of the columns, every one of them must
+                         * be a key of the table. Values that are not keys are skipped.
+                         */
+                        void add(const std::vector<polynomial_dfs_type> &columns) {
+                            const std::size_t cells = columns.size() * rows_amount;
+                            // The keys are fixed, so the threads only increment counts, atomically, in place.
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static)
+#endif
+                            for (std::size_t k = 0; k < cells; k++) {
+                                const std::size_t slot = find(columns[k / rows_amount][k % rows_amount]);
+                                // Every input value is a value of some lookup table
+                                BOOST_ASSERT(slot != npos);
+                                if (slot != npos) {
+#ifdef MULTICORE
+#pragma omp atomic
+#endif
+                                    counts[slot]++;
+                                }
+                            }
+                        }
+
+                        /**
+                         * @return number of occurrences of the value, 0 if it is not a key
+                         */
+                        std::size_t count(const value_type &value) const {
+                            const std::size_t slot = find(value);
+                            return slot == npos ? 0 : counts[slot];
+                        }
+
+                    private:
+                        std::size_t home_slot(const value_type &value) const {
+                            // Fibonacci hashing, spreads the hash over the high bits used as the slot index
+                            const std::uint64_t h = static_cast<std::uint64_t>(std::hash<value_type>()(value));
+                            return static_cast<std::size_t>((h * 0x9E3779B97F4A7C15ull) >> (64 - log_capacity));
+                        }
+
+                        // Slot of the value, npos if it is not a key
+                        std::size_t find(const value_type &value) const {
+                            const std::size_t mask = keys.size() - 1;
+                            for (std::size_t slot = home_slot(value);; slot = (slot + 1) & mask) {
+                                if (!occupied[slot]) {
+                                    return npos;
+                                }
+                                if (keys[slot] == value) {
+                                    return slot;
+                                }
+                            }
+                        }
+
+                        void insert(const value_type &value) {
+                            const std::size_t mask = keys.size() - 1;
+                            for (std::size_t slot = home_slot(value);; slot = (slot + 1) & mask) {
+                                if (!occupied[slot]) {
+                                    keys[slot] = value;
+                                    occupied[slot] = true;
+                                    return;
+                                }
+                                if (keys[slot] == value) {
+                                    return;
+                                }
+                            }
+                        }
+
+                        std::size_t rows_amount;
+                        std::size_t log_capacity;
+                        std::vector<value_type> keys;
+                        std::vector<bool> occupied;
+                        std::vector<std::size_t> counts;
+                    };
+                }    // namespace detail
+            }        // namespace snark
+        }            // namespace zk
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PLONK_PLACEHOLDER_LOOKUP_MULTIPLICITY_TABLE_HPP
@@ -26,6 +26,7 @@
 #define CRYPTO3_PLACEHOLDER_SCOPED_PROFILER_HPP
 
 #include <chrono>
+#include <mutex>
 #include <unordered_map>
 
 namespace nil {
@@ -47,11 +48,18 @@ namespace nil {
                             inline ~placeholder_scoped_profiler() {
                                 auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
                                                 std::chrono::high_resolution_clock::now() - start);
+                                // Stages may run on different threads, e.g. the permutation argument task
+                                std::lock_guard<std::mutex> lock(output_mutex());
                                 std::cout << name << ": " << std::fixed << std::setprecision(3)
                                     << elapsed.count() << " ms" << std::endl;
                             }
                     
                         private:
+                            static std::mutex& output_mutex() {
+                                static std::mutex mutex;
+                                return mutex;
+                            }
+
                             std::chrono::time_point<std::chrono::high_resolution_clock> start;
                             std::string name;
                     };
@@ -64,7 +72,9 @@ namespace nil {
                                 return instance;
                             }
 
+                            // Thread-safe, profiled functions are called from several threads
                             void add_stat(const std::string& name, uint64_t time_ms) {
+                                std::lock_guard<std::mutex> lock(mutex);
                                 call_counts[name]++;
                                 call_miliseconds[name] += time_ms;
                             }
@@ -80,6 +90,7 @@ namespace nil {
                                 }
                             }
 
+                            std::mutex mutex;
                             std::unordered_map<std::string, uint64_t> call_counts;
                             std::unordered_map<std::string, uint64_t> call_miliseconds;
                     };
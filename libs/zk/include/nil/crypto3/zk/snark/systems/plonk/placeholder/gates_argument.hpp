@@ -31,6 +31,7 @@
 #include <unordered_map>
 #include <iostream>
 #include <memory>
+#include <vector>
 
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/shift.hpp>
@@ -49,7 +50,7 @@
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_policy.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/constraint.hpp>
 #include <nil/crypto3/zk/math/expression.hpp>
-#include <nil/crypto3/zk/math/expression_evaluator.hpp>
+#include <nil/crypto3/zk/math/compiled_expression.hpp>
 #include <nil/crypto3/zk/math/expression_visitors.hpp>
 
 namespace nil {
@@ -73,34 +74,74 @@ namespace nil {
 
                     constexpr static const std::size_t argument_size = 1;
 
-                    static inline void build_variable_value_map(
-                        const math::expression<polynomial_dfs_variable_type>& expr,
+                    /**
+                     * Evaluates the expression on the extended domain row by row. Every column used in the
+                     * expression is extended once, the rotated variables read it at the shifted rows, and the
+                     * expression is run as a compiled program over the column values of each row, so the
+                     * memory used does not depend on the number of subexpressions.
+                     */
+                    static inline polynomial_dfs_type evaluate_on_extended_domain(
+                        const math::expression<variable_type>& expr,
                         const plonk_polynomial_dfs_table<FieldType> &assignments,
                         std::shared_ptr<math::evaluation_domain<FieldType>> domain,
-                        std::size_t extended_domain_size,
-                        std::unordered_map<polynomial_dfs_variable_type, polynomial_dfs_type>& variable_values_out) {
+                        std::size_t extended_domain_size) {
 
-                        std::unordered_map<polynomial_dfs_variable_type, size_t> variable_counts;
+                        math::compiled_expression<variable_type> program(expr);
+                        const auto& variables = program.variables();
 
-                        math::expression_for_each_variable_visitor<polynomial_dfs_variable_type> visitor(
-                            [&variable_counts](const polynomial_dfs_variable_type& var) {
-                                variable_counts[var]++;
-                        });
                         std::shared_ptr<math::evaluation_domain<FieldType>> extended_domain =
-                            math::make_evaluation_domain<FieldType>(extended_domain_size);
+                            math::get_cached_evaluation_domain<FieldType>(extended_domain_size);
+                        const std::size_t domain_scale = extended_domain_size / domain->m;
+
+                        std::unordered_map<polynomial_dfs_variable_type, std::size_t> column_ids;
+                        std::vector<polynomial_dfs_variable_type> column_variables;
+                        std::vector<std::size_t> variable_columns(variables.size());
+                        std::vector<std::size_t> variable_shifts(variables.size());
+                        for (std::size_t i = 0; i < variables.size(); ++i) {
+                            const auto& var = variables[i];
+                            polynomial_dfs_variable_type column(var.index, 0, false,
+                                static_cast<typename polynomial_dfs_variable_type::column_type>(var.type));
+                            auto it = column_ids.find(column);
+                            if (it == column_ids.end()) {
+                                it = column_ids.emplace(column, column_variables.size()).first;
+                                column_variables.push_back(column);
+                            }
+                            variable_columns[i] = it->second;
+                            // Rotation by one row of the original domain is a shift by domain_scale rows here.
+                            std::int64_t shift = static_cast<std::int64_t>(var.rotation) * domain_scale;
+                            variable_shifts[i] = (shift % std::int64_t(extended_domain_size) + extended_domain_size) %
+                                extended_domain_size;
+                        }
 
-                        visitor.visit(expr);
+                        std::vector<polynomial_dfs_type> columns(column_variables.size());
+#ifdef MULTICORE
+                        #pragma omp parallel for schedule(dynamic)
+#endif
+                        for (std::size_t i = 0; i < column_variables.size(); ++i) {
+                            columns[i] = assignments.get_variable_value_without_rotation(column_variables[i]);
+                            columns[i].resize(extended_domain_size, domain, extended_domain);
+                        }
 
-                        for (const auto& [var, count]: variable_counts) {
-                            // We may have variable values in required sizes in some cases.
-                            if (variable_values_out.find(var) != variable_values_out.end())
-                                continue;
-                            polynomial_dfs_type assignment = assignments.get_variable_value(var, domain); 
-                            if (count > 1) {
-                                assignment.resize(extended_domain_size, domain, extended_domain);
+                        std::size_t degree = program.degree([&](std::size_t i) {
+                            return columns[variable_columns[i]].degree();
+                        });
+                        polynomial_dfs_type result(std::min(degree, extended_domain_size - 1), extended_domain_size);
+
+                        const std::size_t mask = extended_domain_size - 1;
+                        const std::size_t chunk_size = std::min<std::size_t>(extended_domain_size, 1 << 10);
+#ifdef MULTICORE
+                        #pragma omp parallel for
+#endif
+                        for (std::size_t chunk_start = 0; chunk_start < extended_domain_size; chunk_start += chunk_size) {
+                            std::vector<typename FieldType::value_type> registers = program.make_registers();
+                            for (std::size_t row = chunk_start; row < chunk_start + chunk_size; ++row) {
+                                for (std::size_t i = 0; i < variables.size(); ++i) {
+                                    registers[i] = columns[variable_columns[i]][(row + variable_shifts[i]) & mask];
+                                }
+                                result[row] = program.evaluate(registers);
                             }
-                            variable_values_out[var] = assignment;
                         }
+                        return result;
                     }
 
                     static inline std::array<polynomial_dfs_type, argument_size>
@@ -119,11 +160,6 @@ namespace nil {
                         ++max_gates_degree;
                         typename FieldType::value_type theta = transcript.template challenge<FieldType>();
 
-                        auto value_type_to_polynomial_dfs = [](
-                            const typename variable_type::assignment_type& coeff) {
-                                return polynomial_dfs_type(0, 1, coeff);
-                            };
-
                         std::vector<std::uint32_t> extended_domain_sizes;
                         std::vector<std::uint32_t> degree_limits;
                         std::uint32_t max_degree = std::pow(2, ceil(std::log2(max_gates_degree)));
@@ -134,25 +170,20 @@ namespace nil {
                         degree_limits.push_back(max_degree / 2);
                         extended_domain_sizes.push_back(max_domain_size / 2);
 
-                        std::vector<math::expression<polynomial_dfs_variable_type>> expressions(extended_domain_sizes.size());
+                        std::vector<math::expression<variable_type>> expressions(extended_domain_sizes.size());
 
                         auto theta_acc = FieldType::value_type::one();
 
-                        // Every constraint has variable type 'variable_type', but we want it to use
-                        // 'polynomial_dfs_variable_type' instead. The only difference is the coefficient type
-                        // inside a term. We want the coefficients to be dfs polynomials here.
-                        math::expression_variable_type_converter<variable_type, polynomial_dfs_variable_type> converter(
-                            value_type_to_polynomial_dfs);
-
                         math::expression_max_degree_visitor<variable_type> visitor;
 
                         const auto& gates = constraint_system.gates();
 
                         for (const auto& gate: gates) {
-                            std::vector<math::expression<polynomial_dfs_variable_type>> gate_results(extended_domain_sizes.size());
+                            std::vector<math::expression<variable_type>> gate_results(extended_domain_sizes.size());
 
                             for (const auto& constraint : gate.constraints) {
-                                auto next_term = converter.convert(constraint) * value_type_to_polynomial_dfs(theta_acc);
+                                math::expression<variable_type> next_term =
+                                    static_cast<const math::expression<variable_type>&>(constraint) * theta_acc;
 
                                 theta_acc *= theta;
                                 // +1 stands for the selector multiplication.
@@ -166,8 +197,8 @@ namespace nil {
                                 }
                             }
 
-                            auto selector = polynomial_dfs_variable_type(
-                                gate.selector_index, 0, false, polynomial_dfs_variable_type::column_type::selector);
+                            auto selector = variable_type(
+                                gate.selector_index, 0, false, variable_type::column_type::selector);
 
                             for (size_t i = 0; i < extended_domain_sizes.size(); ++i) {
                                 gate_results[i] *= selector;
@@ -175,24 +206,14 @@ namespace nil {
                             }
                         }
 
-                        std::unordered_map<polynomial_dfs_variable_type, polynomial_dfs_type> variable_values;
                         std::array<polynomial_dfs_type, argument_size> F;
 
                         for (size_t i = 0; i < extended_domain_sizes.size(); ++i) {
-                            if (i != 0 && extended_domain_sizes[i] != extended_domain_sizes[i-1]) {
-                                variable_values.clear();
+                            if (expressions[i].is_empty()) {
+                                continue;
                             }
-                            build_variable_value_map(expressions[i], column_polynomials, original_domain,
-                                extended_domain_sizes[i], variable_values);
-
-                            math::cached_expression_evaluator<polynomial_dfs_variable_type> evaluator(
-                                expressions[i], [&assignments=variable_values, domain_size=extended_domain_sizes[i]]
-                                (const polynomial_dfs_variable_type &var) -> const polynomial_dfs_type& {
-                                    return assignments[var];
-                                }
-                            );
-
-                            F[0] += evaluator.evaluate();
+                            F[0] += evaluate_on_extended_domain(expressions[i], column_polynomials, original_domain,
+                                extended_domain_sizes[i]);
                         }
 
                         F[0] *= mask_polynomial;
@@ -36,6 +36,7 @@
 #include <nil/crypto3/math/polynomial/shift.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/algorithms/grand_product.hpp>
 
 #include <nil/crypto3/hash/sha2.hpp>
 
@@ -45,6 +46,7 @@
 #include <nil/crypto3/zk/snark/arithmetization/plonk/lookup_constraint.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/params.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_policy.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/lookup_multiplicity_table.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/preprocessor.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_scoped_profiler.hpp>
 
@@ -259,8 +261,13 @@ namespace nil {
                                 auto &h = hs[i];
                                 auto reduced_g = reduce_dfs_polynomial_domain(g, basic_domain->m);
                                 auto reduced_h = reduce_dfs_polynomial_domain(h, basic_domain->m);
-                                for( std::size_t j = 0; j < preprocessed_data.common_data.desc.usable_rows_amount; j++){
-                                    current_poly[j] = (previous_poly[j] * reduced_g[j]) * reduced_h[j].inversed();
+                                const std::size_t usable_rows = preprocessed_data.common_data.desc.usable_rows_amount;
+                                math::parallel_batch_inverse(reduced_h.begin(), reduced_h.begin() + usable_rows);
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                                for( std::size_t j = 0; j < usable_rows; j++){
+                                    current_poly[j] = (previous_poly[j] * reduced_g[j]) * reduced_h[j];
                                 }
                                 commitment_scheme.append_to_batch(PERMUTATION_BATCH, current_poly);
                                 auto par = lookup_alphas[i] * (previous_poly * g - current_poly * h);
@@ -379,30 +386,34 @@ namespace nil {
 
                         math::polynomial_dfs<typename FieldType::value_type> V_L(
                             basic_domain->m-1,basic_domain->m, FieldType::value_type::zero());
-                        V_L[0] = FieldType::value_type::one();
                         auto one = FieldType::value_type::one();
-
-                        for (std::size_t k = 1; k <= preprocessed_data.common_data.desc.usable_rows_amount; k++) {
-                            V_L[k] = V_L[k-1];
-
-                            typename FieldType::value_type g_tmp = (one + beta).pow(reduced_input.size());
+                        const std::size_t usable_rows = preprocessed_data.common_data.desc.usable_rows_amount;
+
+                        const typename FieldType::value_type g_init = (one + beta).pow(reduced_input.size());
+                        const auto part1 = (one + beta) * gamma;
+
+                        // V_L[k] = V_L[k - 1] * g_tmp[k - 1] / h_tmp[k - 1]
+                        std::vector<typename FieldType::value_type> g_tmp(usable_rows, g_init);
+                        std::vector<typename FieldType::value_type> h_tmp(usable_rows, one);
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                        for (std::size_t k = 1; k <= usable_rows; k++) {
                             for (std::size_t i = 0; i < reduced_input.size(); i++) {
-                                g_tmp *= gamma + reduced_input[i][k-1];
+                                g_tmp[k-1] *= gamma + reduced_input[i][k-1];
                             }
 
-                            auto part1 = (one + beta) * gamma;
                             for (std::size_t i = 0; i < reduced_value.size(); i++) {
-                                g_tmp *= part1 + reduced_value[i][k-1] + beta * reduced_value[i][k];
+                                g_tmp[k-1] *= part1 + reduced_value[i][k-1] + beta * reduced_value[i][k];
                             }
 
-                            V_L[k] *= g_tmp;
-
-                            typename FieldType::value_type h_tmp = FieldType::value_type::one();
                             for (std::size_t i = 0; i < sorted.size(); i++) {
-                                h_tmp *= part1 + sorted[i][k-1] + beta * sorted[i][k];
+                                h_tmp[k-1] *= part1 + sorted[i][k-1] + beta * sorted[i][k];
                             }
-                            V_L[k] *= h_tmp.inversed();
                         }
+                        const std::vector<typename FieldType::value_type> V_L_values =
+                            math::grand_product(g_tmp, std::move(h_tmp));
+                        std::copy(V_L_values.begin(), V_L_values.end(), V_L.begin());
                         return V_L;
                     }
 
@@ -558,24 +569,9 @@ namespace nil {
                         std::size_t domain_size,
                         std::size_t usable_rows_amount
                     ) {
-                        //  Build sorting map
-                        std::unordered_map<typename FieldType::value_type, std::size_t> sorting_map;
-                        for (std::size_t i = 0; i < reduced_value.size(); i++) {
-                            for (std::size_t j = 0; j < usable_rows_amount; j++) {
-                                if(sorting_map.find(reduced_value[i][j]) != sorting_map.end())
-                                    sorting_map[reduced_value[i][j]]++;
-                                else
-                                    sorting_map[reduced_value[i][j]] = 1;
-                            }
-                        }
-
-                        for (std::size_t i = 0; i < reduced_input.size(); i++) {
-                            for (std::size_t j = 0; j < usable_rows_amount; j++) {
-                                // This assert means that every value \in keys of sorting_map = set of values of reduced_value
-                                BOOST_ASSERT(sorting_map.find(reduced_input[i][j]) != sorting_map.end());
-                                sorting_map[reduced_input[i][j]]++;
-                            }
-                        }
+                        //  Count multiplicities of the table values in table and input columns
+                        detail::lookup_multiplicity_table<FieldType> multiplicities(reduced_value, usable_rows_amount);
+                        multiplicities.add(reduced_input);
 
                         math::polynomial_dfs<typename FieldType::value_type> zero_poly(
                             domain_size-1, domain_size, FieldType::value_type::zero());
@@ -602,7 +598,8 @@ namespace nil {
                                         BOOST_ASSERT(j1 < usable_rows_amount);
                                         append_to_sorted(prev);
                                     } else {
-                                        for (std::size_t k = 0; k < sorting_map[prev]; k++) {
+                                        const std::size_t multiplicity = multiplicities.count(prev);
+                                        for (std::size_t k = 0; k < multiplicity; k++) {
                                             BOOST_ASSERT(j1 < usable_rows_amount);
                                             append_to_sorted(prev);
                                         }
@@ -612,7 +609,8 @@ namespace nil {
                             }
                         }
                         if (prev != FieldType::value_type::zero()) {
-                            for (std::size_t k = 0; k < sorting_map[prev]; k++) {
+                            const std::size_t multiplicity = multiplicities.count(prev);
+                            for (std::size_t k = 0; k < multiplicity; k++) {
                                 //BOOST_ASSERT(j1 < usable_rows_amount);
                                 append_to_sorted(prev);
                             }
@@ -34,6 +34,7 @@
 #include <nil/crypto3/math/polynomial/shift.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/algorithms/grand_product.hpp>
 
 #include <nil/crypto3/hash/sha2.hpp>
 
@@ -65,16 +66,58 @@ namespace nil {
                         std::array<math::polynomial_dfs<typename FieldType::value_type>, argument_size> F_dfs;
 
                         math::polynomial_dfs<typename FieldType::value_type> permutation_polynomial_dfs;
+
+                        // Polynomials to be appended to PERMUTATION_BATCH, in order.
+                        std::vector<math::polynomial_dfs<typename FieldType::value_type>> permutation_batch;
+                    };
+
+                    struct prover_challenges_type {
+                        typename FieldType::value_type beta;
+                        typename FieldType::value_type gamma;
+                        std::vector<typename FieldType::value_type> permutation_alphas;
                     };
 
                     static inline prover_result_type prove_eval(
                         const plonk_constraint_system<FieldType> &constraint_system,
                         const typename placeholder_public_preprocessor<FieldType, ParamsType>::preprocessed_data_type
-                            preprocessed_data,
+                            &preprocessed_data,
                         const plonk_table_description<FieldType> &table_description,
                         const plonk_polynomial_dfs_table<FieldType> &column_polynomials,
                         typename ParamsType::commitment_scheme_type& commitment_scheme,
                         transcript_type& transcript
+                    ) {
+                        prover_result_type res = prove_eval(
+                            constraint_system, preprocessed_data, table_description, column_polynomials,
+                            prove_challenges(preprocessed_data.common_data, transcript));
+                        commitment_scheme.append_to_batch(PERMUTATION_BATCH, res.permutation_batch);
+                        return res;
+                    }
+
+                    // The argument absorbs nothing into the transcript, so all its challenges are drawn at once.
+                    static inline prover_challenges_type prove_challenges(
+                        const typename placeholder_public_preprocessor<FieldType, ParamsType>::preprocessed_data_type::common_data_type
+                            &common_data,
+                        transcript_type& transcript
+                    ) {
+                        prover_challenges_type challenges;
+                        // 1. $\beta_1, \gamma_1 = \challenge$
+                        challenges.beta = transcript.template challenge<FieldType>();
+                        challenges.gamma = transcript.template challenge<FieldType>();
+                        for( std::size_t i = 0; i < common_data.permutation_parts - 1; i++ ){
+                            challenges.permutation_alphas.push_back(transcript.template challenge<FieldType>());
+                        }
+                        return challenges;
+                    }
+
+                    // Computes the argument for the drawn challenges. Neither the transcript nor the commitment
+                    // scheme are used, so the prover may run it concurrently with the other arguments.
+                    static inline prover_result_type prove_eval(
+                        const plonk_constraint_system<FieldType> &constraint_system,
+                        const typename placeholder_public_preprocessor<FieldType, ParamsType>::preprocessed_data_type
+                            &preprocessed_data,
+                        const plonk_table_description<FieldType> &table_description,
+                        const plonk_polynomial_dfs_table<FieldType> &column_polynomials,
+                        const prover_challenges_type &challenges
                     ) {
                         PROFILE_PLACEHOLDER_SCOPE("permutation_argument_prove_eval_time");
 
@@ -91,9 +134,11 @@ namespace nil {
                             global_indices.push_back(table_description.global_index(*it));
                         }
 
-                        // 1. $\beta_1, \gamma_1 = \challenge$
-                        typename FieldType::value_type beta = transcript.template challenge<FieldType>();
-                        typename FieldType::value_type gamma = transcript.template challenge<FieldType>();
+                        const typename FieldType::value_type &beta = challenges.beta;
+                        const typename FieldType::value_type &gamma = challenges.gamma;
+                        const std::vector<typename FieldType::value_type> &permutation_alphas =
+                            challenges.permutation_alphas;
+                        std::vector<math::polynomial_dfs<typename FieldType::value_type>> permutation_batch;
 
                         // 2. Calculate id_binding, sigma_binding for j from 1 to N_rows
                         // 3. Calculate $V_P$
@@ -120,21 +165,27 @@ namespace nil {
                             h_v[i] += column_polynomials[global_indices[i]];
                         }
 
-                        V_P[0] = FieldType::value_type::one();
-                        for (std::size_t j = 1; j < basic_domain->size(); j++) {
-                            typename FieldType::value_type nom = FieldType::value_type::one();
-                            typename FieldType::value_type denom = FieldType::value_type::one();
-
+                        // V_P[j] = V_P[j - 1] * nom[j - 1] / denom[j - 1]
+                        std::vector<typename FieldType::value_type> nom(
+                            basic_domain->size() - 1, FieldType::value_type::one());
+                        std::vector<typename FieldType::value_type> denom(
+                            basic_domain->size() - 1, FieldType::value_type::one());
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                        for (std::size_t j = 0; j < nom.size(); j++) {
                             for (std::size_t i = 0; i < S_id.size(); i++) {
-                                nom *= g_v[i][j - 1];
-                                denom *= h_v[i][j - 1];
+                                nom[j] *= g_v[i][j];
+                                denom[j] *= h_v[i][j];
                             }
-                            V_P[j] = V_P[j - 1] * nom * denom.inversed();
                         }
+                        const std::vector<typename FieldType::value_type> V_P_values =
+                            math::grand_product(nom, std::move(denom));
+                        std::copy(V_P_values.begin(), V_P_values.end(), V_P.begin());
 
                         // 4. Compute and add commitment to $V_P$ to $\text{transcript}$.
                         // TODO: Better enumeration for polynomial batches
-                        commitment_scheme.append_to_batch(PERMUTATION_BATCH, V_P);
+                        permutation_batch.push_back(V_P);
 
                         // 5. Calculate g_perm, h_perm
                         std::vector<math::polynomial_dfs<typename FieldType::value_type>> gs;
@@ -171,10 +222,6 @@ namespace nil {
                         F_dfs[0] = one_polynomial;
                         F_dfs[0] -= V_P;
                         F_dfs[0] *= preprocessed_data.common_data.lagrange_0;
-                        std::vector<typename FieldType::value_type> permutation_alphas;
-                        for( std::size_t i = 0; i < preprocessed_data.common_data.permutation_parts - 1; i++ ){
-                            permutation_alphas.push_back(transcript.template challenge<FieldType>());
-                        }
 
                         /* F_dfs[1] = (one_polynomial - (preprocessed_data.q_last + preprocessed_data.q_blind)) * (V_P_shifted * h - V_P * g); */
                         if ( preprocessed_data.common_data.permutation_parts == 1 ){
@@ -197,10 +244,15 @@ namespace nil {
                                 auto h = hs[i];
                                 auto reduced_g = reduce_dfs_polynomial_domain(g, basic_domain->m);
                                 auto reduced_h = reduce_dfs_polynomial_domain(h, basic_domain->m);
-                                for(std::size_t j = 0; j < preprocessed_data.common_data.desc.usable_rows_amount; j++){
-                                    current_poly[j] = (previous_poly[j] * reduced_g[j]) * reduced_h[j].inversed();
+                                const std::size_t usable_rows = preprocessed_data.common_data.desc.usable_rows_amount;
+                                math::parallel_batch_inverse(reduced_h.begin(), reduced_h.begin() + usable_rows);
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                                for(std::size_t j = 0; j < usable_rows; j++){
+                                    current_poly[j] = (previous_poly[j] * reduced_g[j]) * reduced_h[j];
                                 }
-                                commitment_scheme.append_to_batch(PERMUTATION_BATCH, current_poly);
+                                permutation_batch.push_back(current_poly);
                                 auto part = permutation_alphas[i] * (previous_poly * g - current_poly * h);
                                 F_dfs[1] += part;
                                 previous_poly = current_poly;
@@ -218,7 +270,7 @@ namespace nil {
                         F_dfs[2] *= V_P;
                         F_dfs[2] *= preprocessed_data.q_last;
 
-                        prover_result_type res = {std::move(F_dfs), std::move(V_P)};
+                        prover_result_type res = {std::move(F_dfs), std::move(V_P), std::move(permutation_batch)};
 
                         return res;
                     }
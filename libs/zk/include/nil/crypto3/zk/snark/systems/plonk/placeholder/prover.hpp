@@ -28,9 +28,15 @@
 #ifndef CRYPTO3_ZK_PLONK_PLACEHOLDER_PROVER_HPP
 #define CRYPTO3_ZK_PLONK_PLACEHOLDER_PROVER_HPP
 
+#include <algorithm>
 #include <chrono>
+#include <future>
 #include <set>
 
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 
 #include <nil/crypto3/container/merkle/tree.hpp>
@@ -84,6 +90,7 @@ namespace nil {
 
                     using public_preprocessor_type = placeholder_public_preprocessor<FieldType, ParamsType>;
                     using private_preprocessor_type = placeholder_private_preprocessor<FieldType, ParamsType>;
+                    using permutation_argument_type = placeholder_permutation_argument<FieldType, ParamsType>;
 
                     constexpr static const std::size_t gate_parts = 1;
                     constexpr static const std::size_t permutation_parts = 3;
@@ -143,18 +150,45 @@ namespace nil {
                         transcript(_proof.commitments[VARIABLE_VALUES_BATCH]);
 
                         // 4. permutation_argument
-                        if( constraint_system.copy_constraints().size() > 0 ){
-                            auto permutation_argument = placeholder_permutation_argument<FieldType, ParamsType>::prove_eval(
-                                constraint_system,
-                                preprocessed_public_data,
-                                table_description,
-                                *_polynomial_table,
-                                _commitment_scheme,
-                                transcript);
-
-                            _F_dfs[0] = std::move(permutation_argument.F_dfs[0]);
-                            _F_dfs[1] = std::move(permutation_argument.F_dfs[1]);
-                            _F_dfs[2] = std::move(permutation_argument.F_dfs[2]);
+                        // The permutation argument only draws challenges from the transcript, so once they are
+                        // drawn it is computed concurrently with the lookup argument, which keeps using the
+                        // transcript and the commitment scheme.
+                        //
+                        // This is the only pair of stages run concurrently, there is no general task graph: every
+                        // other stage draws its challenges from a transcript that absorbed the commitment of the
+                        // stage before, so the stages themselves form a chain and the parallelism is inside them.
+                        const bool is_permutation_enabled = constraint_system.copy_constraints().size() > 0;
+                        typename permutation_argument_type::prover_challenges_type permutation_challenges;
+                        if (is_permutation_enabled) {
+                            permutation_challenges = permutation_argument_type::prove_challenges(
+                                preprocessed_public_data.common_data, transcript);
+                        }
+#ifdef MULTICORE
+                        // Both arguments run their own OpenMP loops, so the threads are split between them and the
+                        // two teams do not oversubscribe the cores. The number of threads is a per thread setting:
+                        // the task sets its own, and the one of this thread is restored after the task is done.
+                        const int max_threads = omp_get_max_threads();
+                        const int permutation_threads = std::max(1, max_threads / 2);
+#endif
+                        std::future<typename permutation_argument_type::prover_result_type> permutation_argument;
+                        if (is_permutation_enabled) {
+                            permutation_argument = std::async(
+#ifdef MULTICORE
+                                max_threads > 1 ? std::launch::async : std::launch::deferred,
+#else
+                                std::launch::deferred,
+#endif
+                                [&]() {
+#ifdef MULTICORE
+                                    omp_set_num_threads(permutation_threads);
+#endif
+                                    return permutation_argument_type::prove_eval(
+                                        constraint_system, preprocessed_public_data, table_description,
+                                        *_polynomial_table, permutation_challenges);
+                                });
+#ifdef MULTICORE
+                            omp_set_num_threads(std::max(1, max_threads - permutation_threads));
+#endif
                         }
 
                         // 5. lookup_argument
@@ -166,8 +200,26 @@ namespace nil {
                             _F_dfs[6] = std::move(lookup_argument_result.F_dfs[3]);
                         }
 
+                        if (is_permutation_enabled) {
+                            PROFILE_PLACEHOLDER_SCOPE("permutation_argument_wait_time");
+                            auto permutation_argument_result = permutation_argument.get();
+#ifdef MULTICORE
+                            omp_set_num_threads(max_threads);
+#endif
+                            // The permutation polynomials go first, before the lookup argument ones.
+                            _commitment_scheme.prepend_to_batch(
+                                PERMUTATION_BATCH, permutation_argument_result.permutation_batch);
+
+                            _F_dfs[0] = std::move(permutation_argument_result.F_dfs[0]);
+                            _F_dfs[1] = std::move(permutation_argument_result.F_dfs[1]);
+                            _F_dfs[2] = std::move(permutation_argument_result.F_dfs[2]);
+                        }
+
                         if( constraint_system.copy_constraints().size() > 0 || constraint_system.lookup_gates().size() > 0){
-                            _proof.commitments[PERMUTATION_BATCH] = _commitment_scheme.commit(PERMUTATION_BATCH);
+                            {
+                                PROFILE_PLACEHOLDER_SCOPE("permutation_batch_precommit_time");
+                                _proof.commitments[PERMUTATION_BATCH] = _commitment_scheme.commit(PERMUTATION_BATCH);
+                            }
                             transcript(_proof.commitments[PERMUTATION_BATCH]);
                         }
 
@@ -251,6 +303,9 @@ namespace nil {
                         std::vector<polynomial_dfs_type> T_splitted_dfs(split_polynomial_size,
                             polynomial_dfs_type(0, _F_dfs[0].size(), FieldType::value_type::zero()));
 
+#ifdef MULTICORE
+#pragma omp parallel for schedule(dynamic)
+#endif
                         for (std::size_t k = 0; k < T_splitted.size(); k++) {
                             T_splitted_dfs[k].from_coefficients(T_splitted[k]);
                         }
@@ -266,6 +321,9 @@ namespace nil {
 
                         // 7.2. Compute F_consolidated
                         std::vector<polynomial_dfs_type> F_consolidated_dfs_parts(_F_dfs.begin(), _F_dfs.end());
+#ifdef MULTICORE
+#pragma omp parallel for schedule(dynamic)
+#endif
                         for (std::size_t i = 0; i < F_consolidated_dfs_parts.size(); ++i) {
                             if (_F_dfs[i].is_zero()) {
                                 continue;
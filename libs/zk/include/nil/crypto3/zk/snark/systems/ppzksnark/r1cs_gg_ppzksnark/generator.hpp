@@ -187,9 +187,7 @@ namespace nil {
                         typename std::vector<typename g1_type::value_type> A_query =
                             algebra::batch_exp<g1_type, scalar_field_type>(g1_scalar_size, g1_window_size, g1_table,
                                                                            At);
-#ifdef USE_MIXED_ADDITION
-                        algebra::batch_to_special<g1_type>(A_query);
-#endif
+                        algebra::batch_normalize<g1_type>(A_query);
 
                         commitments::knowledge_commitment_vector<g2_type, g1_type> B_query =
                             commitments::kc_batch_exp<g2_type, g1_type, scalar_field_type>(
@@ -202,17 +200,13 @@ namespace nil {
                         typename std::vector<typename g1_type::value_type> H_query =
                             algebra::batch_exp_with_coeff<g1_type, scalar_field_type>(
                                 g1_scalar_size, g1_window_size, g1_table, qap.Zt * delta_inverse, Ht);
-#ifdef USE_MIXED_ADDITION
-                        algebra::batch_to_special<g1_type>(H_query);
-#endif
+                        algebra::batch_normalize<g1_type>(H_query);
 
                         typename std::vector<typename g1_type::value_type> L_query =
                             algebra::batch_exp<g1_type, scalar_field_type>(g1_scalar_size, g1_window_size, g1_table,
                                                                            Lt);
 
-#ifdef USE_MIXED_ADDITION
-                        algebra::batch_to_special<g1_type>(L_query);
-#endif
+                        algebra::batch_normalize<g1_type>(L_query);
 
                         typename gt_type::value_type alpha_g1_beta_g2 = pair_reduced<CurveType>(alpha_g1, beta_g2);
                         typename g2_type::value_type gamma_g2 = gamma * G2_gen;
@@ -222,6 +216,7 @@ namespace nil {
                         typename std::vector<typename g1_type::value_type> gamma_ABC_g1_values =
                             algebra::batch_exp<g1_type, scalar_field_type>(g1_scalar_size, g1_window_size, g1_table,
                                                                            gamma_ABC);
+                        algebra::batch_normalize<g1_type>(gamma_ABC_g1_values);
 
                         typename g1_type::value_type gamma_g1 = gamma * g1_generator;
 
@@ -336,9 +331,7 @@ namespace nil {
                         typename std::vector<typename g1_type::value_type> A_query =
                             algebra::batch_exp<g1_type, scalar_field_type>(g1_scalar_size, g1_window_size, g1_table,
                                                                            At);
-#ifdef USE_MIXED_ADDITION
-                        algebra::batch_to_special<g1_type>(A_query);
-#endif
+                        algebra::batch_normalize<g1_type>(A_query);
 
                         commitments::knowledge_commitment_vector<g2_type, g1_type> B_query =
                             commitments::kc_batch_exp<g2_type, g1_type, scalar_field_type>(
@@ -351,17 +344,13 @@ namespace nil {
                         typename std::vector<typename g1_type::value_type> H_query =
                             algebra::batch_exp_with_coeff<g1_type, scalar_field_type>(
                                 g1_scalar_size, g1_window_size, g1_table, qap.Zt * delta_inverse, Ht);
-#ifdef USE_MIXED_ADDITION
-                        algebra::batch_to_special<g1_type>(H_query);
-#endif
+                        algebra::batch_normalize<g1_type>(H_query);
 
                         typename std::vector<typename g1_type::value_type> L_query =
                             algebra::batch_exp<g1_type, scalar_field_type>(g1_scalar_size, g1_window_size, g1_table,
                                                                            Lt);
 
-#ifdef USE_MIXED_ADDITION
-                        algebra::batch_to_special<g1_type>(L_query);
-#endif
+                        algebra::batch_normalize<g1_type>(L_query);
 
                         typename gt_type::value_type alpha_g1_beta_g2 = pair_reduced<CurveType>(alpha_g1, beta_g2);
                         typename g2_type::value_type gamma_g2 = gamma * G2_gen;
@@ -371,6 +360,7 @@ namespace nil {
                         typename std::vector<typename g1_type::value_type> gamma_ABC_g1_values =
                             algebra::batch_exp<g1_type, scalar_field_type>(g1_scalar_size, g1_window_size, g1_table,
                                                                            gamma_ABC);
+                        algebra::batch_normalize<g1_type>(gamma_ABC_g1_values);
 
                         typename g1_type::value_type gamma_g1 = gamma * g1_generator;
 
@@ -30,6 +30,8 @@
 #include <vector>
 #include <tuple>
 
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+
 #include <nil/crypto3/zk/commitments/polynomial/kzg_ipp2.hpp>
 
 #include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/keypair.hpp>
@@ -45,13 +47,7 @@ namespace nil {
                     structured_generators_scalar_power(std::size_t n, const typename ScalarFieldType::value_type &s) {
                     BOOST_ASSERT(n > 0);
 
-                    std::vector<typename GroupType::value_type> powers_of_g {GroupType::value_type::one()};
-
-                    for (std::size_t i = 1; i < n; i++) {
-                        powers_of_g.emplace_back(powers_of_g.back() * s);
-                    }
-
-                    return powers_of_g;
+                    return algebra::batch_exp_powers<GroupType, ScalarFieldType>(GroupType::value_type::one(), s, n);
                 }
 
                 /// ProverSRS is the specialized SRS version for the prover for a specific number of proofs to
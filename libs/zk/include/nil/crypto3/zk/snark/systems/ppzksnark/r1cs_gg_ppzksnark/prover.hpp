@@ -30,6 +30,7 @@
 #include <omp.h>
 #endif
 
+#include <nil/crypto3/algebra/multiexp/fixed_base_multiexp.hpp>
 #include <nil/crypto3/algebra/multiexp/multiexp.hpp>
 #include <nil/crypto3/algebra/multiexp/policies.hpp>
 #include <nil/crypto3/algebra/random_element.hpp>
@@ -106,7 +107,7 @@ namespace nil {
                                                        qap_wit.coefficients_for_ABCs.end());
 
                         typename g1_type::value_type evaluation_At =
-                                algebra::multiexp_with_mixed_addition<algebra::policies::multiexp_method_BDLO12>(
+                                algebra::multiexp_with_mixed_addition<algebra::policies::multiexp_method_pippenger>(
                                         proving_key.A_query.begin(),
                                         proving_key.A_query.begin() + qap_wit.num_variables + 1,
                                         const_padded_assignment.begin(),
@@ -114,7 +115,7 @@ namespace nil {
                                         chunks);
 
                         typename commitments::knowledge_commitment<g2_type, g1_type>::value_type evaluation_Bt =
-                                commitments::kc_multiexp_with_mixed_addition<algebra::policies::multiexp_method_BDLO12>(
+                                commitments::kc_multiexp_with_mixed_addition<algebra::policies::multiexp_method_pippenger>(
                                         proving_key.B_query,
                                         0,
                                         qap_wit.num_variables + 1,
@@ -123,7 +124,12 @@ namespace nil {
                                         chunks);
 
                         typename g1_type::value_type evaluation_Ht =
-                                algebra::multiexp<algebra::policies::multiexp_method_BDLO12>(
+                                proving_key.H_query_table ?
+                                algebra::fixed_base_multiexp(
+                                        *proving_key.H_query_table,
+                                        qap_wit.coefficients_for_H.begin(),
+                                        qap_wit.coefficients_for_H.begin() + (qap_wit.degree - 1)) :
+                                algebra::multiexp<algebra::policies::multiexp_method_pippenger>(
                                         proving_key.H_query.begin(),
                                         proving_key.H_query.begin() + (qap_wit.degree - 1),
                                         qap_wit.coefficients_for_H.begin(),
@@ -131,7 +137,12 @@ namespace nil {
                                         chunks);
 
                         typename g1_type::value_type evaluation_Lt =
-                                algebra::multiexp_with_mixed_addition<algebra::policies::multiexp_method_BDLO12>(
+                                proving_key.L_query_table ?
+                                algebra::fixed_base_multiexp(
+                                        *proving_key.L_query_table,
+                                        const_padded_assignment.begin() + qap_wit.num_inputs + 1,
+                                        const_padded_assignment.begin() + qap_wit.num_variables + 1) :
+                                algebra::multiexp_with_mixed_addition<algebra::policies::multiexp_method_pippenger>(
                                         proving_key.L_query.begin(),
                                         proving_key.L_query.end(),
                                         const_padded_assignment.begin() + qap_wit.num_inputs + 1,
@@ -26,6 +26,10 @@
 #ifndef CRYPTO3_R1CS_GG_PPZKSNARK_PROVING_KEY_HPP
 #define CRYPTO3_R1CS_GG_PPZKSNARK_PROVING_KEY_HPP
 
+#include <memory>
+
+#include <nil/crypto3/algebra/multiexp/fixed_base_multiexp.hpp>
+
 #include <nil/crypto3/zk/commitments/polynomial/knowledge_commitment.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/constraint_satisfaction_problems/r1cs.hpp>
 #include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/modes.hpp>
@@ -56,6 +60,12 @@ namespace nil {
 
                     constraint_system_type constraint_system;
 
+                    // Optional fixed-base multiexp tables of H_query and L_query, used by the prover when present
+                    std::shared_ptr<const algebra::fixed_base_multiexp_table<typename CurveType::template g1_type<>::value_type>>
+                        H_query_table;
+                    std::shared_ptr<const algebra::fixed_base_multiexp_table<typename CurveType::template g1_type<>::value_type>>
+                        L_query_table;
+
                     r1cs_gg_ppzksnark_proving_key() {};
                     r1cs_gg_ppzksnark_proving_key &operator=(const r1cs_gg_ppzksnark_proving_key &other) = default;
                     r1cs_gg_ppzksnark_proving_key(const r1cs_gg_ppzksnark_proving_key &other) = default;
@@ -95,6 +105,22 @@ namespace nil {
                         H_query(std::move(H_query)), L_query(std::move(L_query)),
                         constraint_system(std::move(constraint_system)) {};
 
+                    /**
+                     * Precomputes the fixed-base multiexp tables of H_query and L_query, each within memory_budget
+                     * bytes if possible (0 means no limit), so that proving does no per-proof precomputation on them.
+                     */
+                    void precompute_query_tables(std::size_t memory_budget = 0) {
+                        using g1_value_type = typename CurveType::template g1_type<>::value_type;
+                        constexpr std::size_t scalar_bits = CurveType::scalar_field_type::modulus_bits;
+
+                        H_query_table = std::make_shared<algebra::fixed_base_multiexp_table<g1_value_type>>(
+                            algebra::make_fixed_base_multiexp_table(H_query.begin(), H_query.end(), scalar_bits,
+                                                                    memory_budget));
+                        L_query_table = std::make_shared<algebra::fixed_base_multiexp_table<g1_value_type>>(
+                            algebra::make_fixed_base_multiexp_table(L_query.begin(), L_query.end(), scalar_bits,
+                                                                    memory_budget));
+                    }
+
                     std::size_t G1_size() const {
                         return 1 + A_query.size() + B_query.domain_size() + H_query.size() + L_query.size();
                     }
@@ -50,6 +50,8 @@
 #ifndef CRYPTO3_ZK_R1CS_GG_PPZKSNARK_BASIC_VERIFIER_HPP
 #define CRYPTO3_ZK_R1CS_GG_PPZKSNARK_BASIC_VERIFIER_HPP
 
+#include <vector>
+
 #include <nil/crypto3/algebra/algorithms/pair.hpp>
 
 #include <nil/crypto3/container/accumulation_vector.hpp>
@@ -165,18 +167,17 @@ namespace nil {
                             result = false;
                         }
 
-                        const g1_precomputed_type proof_g_A_precomp = precompute_g1<CurveType>(proof.g_A);
-                        const g2_precomputed_type proof_g_B_precomp = precompute_g2<CurveType>(proof.g_B);
-                        const g1_precomputed_type proof_g_C_precomp = precompute_g1<CurveType>(proof.g_C);
-                        const g1_precomputed_type acc_precomp = precompute_g1<CurveType>(acc);
+                        // e(A, B) * e(-acc, gamma) * e(-C, delta) in one Miller loop, the negated points give the
+                        // inverse pairings after the final exponentiation.
+                        const std::vector<g1_precomputed_type> g1_precomp = {precompute_g1<CurveType>(proof.g_A),
+                                                                             precompute_g1<CurveType>(-acc),
+                                                                             precompute_g1<CurveType>(-proof.g_C)};
+                        const std::vector<g2_precomputed_type> g2_precomp = {
+                            precompute_g2<CurveType>(proof.g_B), processed_verification_key.vk_gamma_g2_precomp,
+                            processed_verification_key.vk_delta_g2_precomp};
 
-                        const typename gt_type::value_type QAP1 =
-                            miller_loop<CurveType>(proof_g_A_precomp, proof_g_B_precomp);
-                        const typename gt_type::value_type QAP2 = double_miller_loop<CurveType>(
-                            acc_precomp, processed_verification_key.vk_gamma_g2_precomp, proof_g_C_precomp,
-                            processed_verification_key.vk_delta_g2_precomp);
                         const typename gt_type::value_type QAP =
-                            final_exponentiation<CurveType>(QAP1 * QAP2.unitary_inversed());
+                            final_exponentiation<CurveType>(multi_miller_loop<CurveType>(g1_precomp, g2_precomp));
 
                         if (QAP != processed_verification_key.vk_alpha_g1_beta_g2) {
                             result = false;
@@ -0,0 +1,333 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_TRANSCRIPT_DUPLEX_SPONGE_HPP
+#define CRYPTO3_ZK_TRANSCRIPT_DUPLEX_SPONGE_HPP
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+#include <boost/static_assert.hpp>
+
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/poseidon.hpp>
+#include <nil/crypto3/hash/detail/keccak/keccak_impl.hpp>
+#include <nil/crypto3/hash/detail/poseidon/poseidon_permutation.hpp>
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace transcript {
+
+                /*!
+                 * @brief Selects the duplex sponge transcript over the permutation of Hash, used as the transcript
+                 * hash type, e.g. duplex_sponge<hashes::keccak_1600<256>>.
+                 *
+                 * fiat_shamir_heuristic_sequential keeps the sponge state between calls instead of hashing the
+                 * previous digest together with every new input. Field and group elements are absorbed straight
+                 * into the rate, challenges are squeezed one after another from the same permutation output.
+                 * Everything else, e.g. hash<duplex_sponge<Hash>>, is the same as for Hash.
+                 *
+                 * Supported hashes are keccak_1600 and the Poseidon hashes, whose transcripts take challenges
+                 * in the field of the permutation.
+                 */
+                template<typename Hash>
+                struct duplex_sponge : public Hash {
+                    typedef Hash underlying_hash_type;
+
+                    using accumulator_tag = typename std::conditional<
+                        algebra::is_field_element<typename Hash::word_type>::value,
+                        accumulators::tag::algebraic_hash<duplex_sponge<Hash>>,
+                        accumulators::tag::hash<duplex_sponge<Hash>>>::type;
+                };
+
+                template<typename T>
+                struct is_duplex_sponge : std::false_type { };
+
+                template<typename Hash>
+                struct is_duplex_sponge<duplex_sponge<Hash>> : std::true_type { };
+
+                namespace detail {
+                    // f(byte) for the bytes of the canonical representation of a prime field element, least
+                    // significant first. The number of bytes depends on the field only.
+                    template<typename FieldValueType, typename Function>
+                    void for_each_field_element_byte(const FieldValueType &element, Function f) {
+                        typedef typename FieldValueType::field_type field_type;
+                        typedef typename field_type::integral_type integral_type;
+
+                        constexpr std::size_t bytes = (field_type::modulus_bits + 7) / 8;
+                        integral_type value(element.data);
+                        for (std::size_t i = 0; i < bytes; i += 8) {
+                            integral_type low = value;
+                            low &= integral_type(~std::uint64_t(0));
+                            std::uint64_t limb = static_cast<std::uint64_t>(low);
+                            for (std::size_t j = i; j < bytes && j < i + 8; j++) {
+                                f(static_cast<std::uint8_t>(limb));
+                                limb >>= 8;
+                            }
+                            value >>= 64;
+                        }
+                    }
+
+                    /*!
+                     * @brief Byte-oriented duplex sponge over Keccak-f[1600], with the rate of keccak_1600.
+                     *
+                     * Absorbed bytes are XORed into the rate. Switching to squeezing pads the input with
+                     * pad10*1 and permutes, so absorbing a message and a message with extra zero bytes yields
+                     * different outputs. Absorbing after squeezing starts over at the beginning of the rate.
+                     */
+                    template<std::size_t DigestBits>
+                    class keccak_duplex_sponge {
+                    public:
+                        typedef hashes::detail::keccak_1600_policy<DigestBits> policy_type;
+                        typedef typename policy_type::state_type state_type;
+                        typedef hashes::detail::keccak_1600_impl<policy_type> permutation_type;
+
+                        constexpr static const std::size_t rate_bytes = policy_type::block_bits / 8;
+
+                        keccak_duplex_sponge() : position(0), squeezing(false) {
+                            state.fill(0);
+                        }
+
+                        void absorb_byte(std::uint8_t byte) {
+                            if (squeezing) {
+                                squeezing = false;
+                                position = 0;
+                            }
+                            if (position == rate_bytes) {
+                                permutation_type::permute(state);
+                                position = 0;
+                            }
+                            state[position / 8] ^= std::uint64_t(byte) << (8 * (position % 8));
+                            position++;
+                        }
+
+                        template<typename InputIterator>
+                        void absorb_bytes(InputIterator first, InputIterator last) {
+                            for (; first != last; ++first) {
+                                absorb_byte(static_cast<std::uint8_t>(*first));
+                            }
+                        }
+
+                        template<typename FieldValueType>
+                        void absorb_field_element(const FieldValueType &element) {
+                            for_each_field_element_byte(element, [this](std::uint8_t byte) { absorb_byte(byte); });
+                        }
+
+                        std::uint8_t squeeze_byte() {
+                            if (!squeezing) {
+                                if (position == rate_bytes) {
+                                    permutation_type::permute(state);
+                                    position = 0;
+                                }
+                                state[position / 8] ^= std::uint64_t(0x01) << (8 * (position % 8));
+                                state[(rate_bytes - 1) / 8] ^= std::uint64_t(0x80) << (8 * ((rate_bytes - 1) % 8));
+                                permutation_type::permute(state);
+                                squeezing = true;
+                                position = 0;
+                            }
+                            if (position == rate_bytes) {
+                                permutation_type::permute(state);
+                                position = 0;
+                            }
+                            const std::uint8_t byte = static_cast<std::uint8_t>(state[position / 8] >> (8 * (position % 8)));
+                            position++;
+                            return byte;
+                        }
+
+                        /*!
+                         * @brief Element of Field from modulus_bits + 128 squeezed bits, so that its distance from
+                         * the uniform distribution is below 2^-128.
+                         */
+                        template<typename Field>
+                        typename Field::value_type squeeze_field_element() {
+                            typedef typename Field::value_type value_type;
+
+                            constexpr std::size_t limbs = (Field::modulus_bits + 128 + 63) / 64;
+                            const value_type two_32 = value_type(std::uint64_t(1) << 32);
+                            const value_type two_64 = two_32 * two_32;
+
+                            value_type result = value_type::zero();
+                            for (std::size_t i = 0; i < limbs; i++) {
+                                result = result * two_64 + value_type(squeeze_integral<std::uint64_t>());
+                            }
+                            return result;
+                        }
+
+                        template<typename Integral>
+                        Integral squeeze_integral() {
+                            Integral result = 0;
+                            for (std::size_t i = 0; i < sizeof(Integral); i++) {
+                                result = static_cast<Integral>(result << 8) | static_cast<Integral>(squeeze_byte());
+                            }
+                            return result;
+                        }
+
+                    private:
+                        state_type state;
+                        std::size_t position;
+                        bool squeezing;
+                    };
+
+                    /*!
+                     * @brief Algebraic duplex sponge over a Poseidon permutation. The capacity takes the first
+                     * words of the state, the rest is the rate.
+                     *
+                     * Absorbed elements are added to the rate, switching to squeezing adds 1 after the last
+                     * absorbed element before permuting. A byte string is absorbed as its length followed by
+                     * its bytes packed into elements of (modulus_bits - 1) / 8 bytes.
+                     */
+                    template<typename PolicyType>
+                    class poseidon_duplex_sponge {
+                    public:
+                        typedef PolicyType policy_type;
+                        typedef typename policy_type::field_type field_type;
+                        typedef typename policy_type::word_type word_type;
+                        typedef typename policy_type::state_type state_type;
+                        typedef hashes::detail::poseidon_permutation<policy_type> permutation_type;
+
+                        constexpr static const std::size_t rate = policy_type::rate;
+                        constexpr static const std::size_t capacity = policy_type::capacity;
+                        constexpr static const std::size_t bytes_per_element = (field_type::modulus_bits - 1) / 8;
+
+                        poseidon_duplex_sponge() : position(0), squeezing(false) {
+                            state.fill(word_type::zero());
+                        }
+
+                        void absorb(const word_type &element) {
+                            if (squeezing) {
+                                squeezing = false;
+                                position = 0;
+                            }
+                            if (position == rate) {
+                                permutation_type::permute(state);
+                                position = 0;
+                            }
+                            state[capacity + position] += element;
+                            position++;
+                        }
+
+                        template<typename InputIterator>
+                        void absorb_bytes(InputIterator first, InputIterator last) {
+                            // Packing drops leading zero bytes of a chunk, the length keeps the encoding injective.
+                            absorb(word_type(static_cast<std::uint64_t>(std::distance(first, last))));
+
+                            const word_type radix = word_type(256u);
+                            word_type packed = word_type::zero();
+                            std::size_t packed_bytes = 0;
+                            for (; first != last; ++first) {
+                                packed = packed * radix + word_type(static_cast<std::uint8_t>(*first));
+                                if (++packed_bytes == bytes_per_element) {
+                                    absorb(packed);
+                                    packed = word_type::zero();
+                                    packed_bytes = 0;
+                                }
+                            }
+                            if (packed_bytes != 0) {
+                                absorb(packed);
+                            }
+                        }
+
+                        template<typename FieldValueType>
+                        void absorb_field_element(const FieldValueType &element) {
+                            if constexpr (std::is_same<FieldValueType, word_type>::value) {
+                                absorb(element);
+                            } else {
+                                // Elements of other fields may not fit, they are absorbed as bytes.
+                                std::array<std::uint8_t, (FieldValueType::field_type::modulus_bits + 7) / 8> bytes;
+                                std::size_t i = 0;
+                                for_each_field_element_byte(element, [&bytes, &i](std::uint8_t byte) {
+                                    bytes[i++] = byte;
+                                });
+                                absorb_bytes(bytes.begin(), bytes.end());
+                            }
+                        }
+
+                        word_type squeeze() {
+                            if (!squeezing) {
+                                if (position == rate) {
+                                    permutation_type::permute(state);
+                                    position = 0;
+                                }
+                                state[capacity + position] += word_type::one();
+                                permutation_type::permute(state);
+                                squeezing = true;
+                                position = 0;
+                            }
+                            if (position == rate) {
+                                permutation_type::permute(state);
+                                position = 0;
+                            }
+                            return state[capacity + position++];
+                        }
+
+                        template<typename Field>
+                        typename Field::value_type squeeze_field_element() {
+                            BOOST_STATIC_ASSERT_MSG(
+                                (std::is_same<typename Field::value_type, word_type>::value),
+                                "Poseidon duplex sponge squeezes elements of the field of its permutation only");
+                            return squeeze();
+                        }
+
+                        template<typename Integral>
+                        Integral squeeze_integral() {
+                            typename field_type::integral_type raw_result(squeeze().data);
+                            raw_result &= ~Integral(0);
+                            return static_cast<Integral>(raw_result);
+                        }
+
+                    private:
+                        state_type state;
+                        std::size_t position;
+                        bool squeezing;
+                    };
+
+                    template<typename Hash>
+                    struct duplex_sponge_of;
+
+                    template<std::size_t DigestBits>
+                    struct duplex_sponge_of<hashes::keccak_1600<DigestBits>> {
+                        typedef keccak_duplex_sponge<DigestBits> type;
+                    };
+
+                    template<typename PolicyType>
+                    struct duplex_sponge_of<hashes::poseidon<PolicyType>> {
+                        typedef poseidon_duplex_sponge<PolicyType> type;
+                    };
+
+                    template<typename PolicyType>
+                    struct duplex_sponge_of<hashes::original_poseidon<PolicyType>> {
+                        typedef poseidon_duplex_sponge<PolicyType> type;
+                    };
+                }    // namespace detail
+            }        // namespace transcript
+        }            // namespace zk
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_TRANSCRIPT_DUPLEX_SPONGE_HPP
@@ -27,6 +27,8 @@
 #ifndef CRYPTO3_ZK_TRANSCRIPT_FIAT_SHAMIR_HEURISTIC_HPP
 #define CRYPTO3_ZK_TRANSCRIPT_FIAT_SHAMIR_HEURISTIC_HPP
 
+#include <iterator>
+
 #include <nil/marshalling/algorithms/pack.hpp>
 #include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
 #include <nil/crypto3/marshalling/algebra/types/curve_element.hpp>
@@ -44,6 +46,8 @@
 #include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
 #include <nil/crypto3/algebra/type_traits.hpp>
 
+#include <nil/crypto3/zk/transcript/duplex_sponge.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace zk {
@@ -155,9 +159,7 @@ namespace nil {
                     typename std::enable_if_t<!algebra::is_group_element<InputRange>::value &&
                                               !algebra::is_field_element<InputRange>::value>
                         operator()(const InputRange &r) {
-                        auto acc_convertible = hash<hash_type>(state);
-                        state = accumulators::extract::hash<hash_type>(
-                            hash<hash_type>(r, static_cast<accumulator_set<hash_type> &>(acc_convertible)));
+                        absorb_from(absorbed_state(), r);
                     }
 
                     template<typename InputIterator>
@@ -171,13 +173,40 @@ namespace nil {
                     typename std::enable_if_t<algebra::is_group_element<element>::value ||
                                               algebra::is_field_element<element>::value>
                         operator()(element const &data) {
+                        absorb_from(absorbed_state(), data);
+                    }
+
+                    /*!
+                     * @brief Hash accumulator with the current state absorbed, every absorption starts from it.
+                     *
+                     * Callers absorbing many alternatives of the same data into one transcript, like proof of work
+                     * grinding, build it once and pass copies to absorb_from.
+                     */
+                    accumulator_set<hash_type> absorbed_state() const {
+                        accumulator_set<hash_type> acc;
+                        hash<hash_type>(state, acc);
+                        return acc;
+                    }
+
+                    /*!
+                     * @brief Same as operator() for a transcript whose absorbed_state() was acc.
+                     */
+                    template<typename InputRange>
+                    typename std::enable_if_t<!algebra::is_group_element<InputRange>::value &&
+                                              !algebra::is_field_element<InputRange>::value>
+                        absorb_from(accumulator_set<hash_type> acc, const InputRange &r) {
+                        state = accumulators::extract::hash<hash_type>(hash<hash_type>(r, acc));
+                    }
+
+                    template<typename element>
+                    typename std::enable_if_t<algebra::is_group_element<element>::value ||
+                                              algebra::is_field_element<element>::value>
+                        absorb_from(accumulator_set<hash_type> acc, element const &data) {
                         nil::marshalling::status_type status;
                         std::vector<std::uint8_t> byte_data =
                             nil::marshalling::pack<nil::marshalling::option::big_endian>(data, status);
                         BOOST_ASSERT(status == nil::marshalling::status_type::success);
-                        auto acc_convertible = hash<hash_type>(state);
-                        state = accumulators::extract::hash<hash_type>(
-                            hash<hash_type>(byte_data, static_cast<accumulator_set<hash_type> &>(acc_convertible)));
+                        state = accumulators::extract::hash<hash_type>(hash<hash_type>(byte_data, acc));
                     }
 
                     template<typename Field>
@@ -359,6 +388,104 @@ namespace nil {
                     hashes::detail::poseidon_sponge_construction_custom<typename Hash::policy_type> sponge;
                 };
 
+                /*!
+                 * @brief Fiat–Shamir transcript over a duplex sponge, see duplex_sponge.
+                 *
+                 * Byte ranges, such as digests of merkle roots, go to the sponge byte by byte. Prime field
+                 * elements are absorbed directly, elements of extension fields component by component, group
+                 * elements by their affine coordinates. Nothing is marshalled into intermediate buffers.
+                 */
+                template<typename Hash>
+                struct fiat_shamir_heuristic_sequential<Hash, typename std::enable_if_t<is_duplex_sponge<Hash>::value>> {
+                    typedef Hash hash_type;
+                    typedef typename detail::duplex_sponge_of<typename Hash::underlying_hash_type>::type sponge_type;
+
+                    fiat_shamir_heuristic_sequential() {
+                    }
+
+                    template<typename InputRange>
+                    fiat_shamir_heuristic_sequential(const InputRange &r) {
+                        (*this)(r);
+                    }
+
+                    template<typename InputIterator>
+                    fiat_shamir_heuristic_sequential(InputIterator first, InputIterator last) {
+                        (*this)(first, last);
+                    }
+
+                    template<typename InputRange>
+                    typename std::enable_if_t<!algebra::is_group_element<InputRange>::value &&
+                                              !algebra::is_field_element<InputRange>::value>
+                        operator()(const InputRange &r) {
+                        (*this)(std::begin(r), std::end(r));
+                    }
+
+                    template<typename InputIterator>
+                    void operator()(InputIterator first, InputIterator last) {
+                        typedef typename std::iterator_traits<InputIterator>::value_type value_type;
+                        if constexpr (std::is_integral<value_type>::value) {
+                            BOOST_STATIC_ASSERT_MSG(sizeof(value_type) == 1, "Only byte ranges are absorbed as integers");
+                            sponge.absorb_bytes(first, last);
+                        } else {
+                            for (; first != last; ++first) {
+                                absorb(*first);
+                            }
+                        }
+                    }
+
+                    template<typename element>
+                    typename std::enable_if_t<algebra::is_group_element<element>::value ||
+                                              algebra::is_field_element<element>::value>
+                        operator()(element const &data) {
+                        absorb(data);
+                    }
+
+                    template<typename Field>
+                    typename Field::value_type challenge() {
+                        return sponge.template squeeze_field_element<Field>();
+                    }
+
+                    template<typename Integral>
+                    Integral int_challenge() {
+                        return sponge.template squeeze_integral<Integral>();
+                    }
+
+                    /*!
+                     * @brief N challenges squeezed one after another, the permutation runs once per rate.
+                     */
+                    template<typename Field, std::size_t N>
+                    std::array<typename Field::value_type, N> challenges() {
+
+                        std::array<typename Field::value_type, N> result;
+                        for (auto &ch : result) {
+                            ch = sponge.template squeeze_field_element<Field>();
+                        }
+
+                        return result;
+                    }
+
+                private:
+                    template<typename Element>
+                    void absorb(const Element &data) {
+                        if constexpr (algebra::is_group_element<Element>::value) {
+                            auto affine = data.to_affine();
+                            absorb(affine.X);
+                            absorb(affine.Y);
+                        } else if constexpr (algebra::is_extended_field_element<Element>::value) {
+                            for (const auto &component : data.data) {
+                                absorb(component);
+                            }
+                        } else if constexpr (algebra::is_field_element<Element>::value) {
+                            sponge.absorb_field_element(data);
+                        } else {
+                            // Digests and other byte containers
+                            (*this)(std::begin(data), std::end(data));
+                        }
+                    }
+
+                    sponge_type sponge;
+                };
+
             }    // namespace transcript
         }    // namespace zk
     }    // namespace crypto3
@@ -0,0 +1,106 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// Placeholder prover stages timings on the test circuits. Every stage of the prover
+// prints its time, the stages running concurrently print theirs from their own threads.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE placeholder_prover_stages_test
+
+// Do it manually for all performance tests
+#define ZK_PLACEHOLDER_PROFILING_ENABLED
+
+#include <iostream>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/poseidon.hpp>
+
+#include <nil/crypto3/zk/test_tools/random_test_initializer.hpp>
+
+#include "../systems/plonk/placeholder/circuits.hpp"
+#include "../systems/plonk/placeholder/placeholder_test_runner.hpp"
+
+BOOST_AUTO_TEST_SUITE(placeholder_prover_stages_test_suite)
+
+    using curve_type = algebra::curves::pallas;
+    using field_type = typename curve_type::base_field_type;
+    using poseidon_type = hashes::poseidon<nil::crypto3::hashes::detail::mina_poseidon_policy<field_type>>;
+    using keccak_type = hashes::keccak_1600<256>;
+    using poseidon_runner_type = placeholder_test_runner<field_type, poseidon_type, poseidon_type>;
+    using keccak_runner_type = placeholder_test_runner<field_type, keccak_type, keccak_type>;
+
+    BOOST_AUTO_TEST_CASE(permutation_circuit) {
+        std::cout << "circuit_test_1:" << std::endl;
+        test_tools::random_test_initializer<field_type> random_test_initializer;
+        auto circuit = circuit_test_1<field_type>(
+            random_test_initializer.alg_random_engines.template get_alg_engine<field_type>(),
+            random_test_initializer.generic_random_engine);
+        keccak_runner_type test_runner(circuit);
+        BOOST_CHECK(test_runner.run_test());
+    }
+
+    BOOST_AUTO_TEST_CASE(lookup_circuit) {
+        std::cout << "circuit_test_3:" << std::endl;
+        test_tools::random_test_initializer<field_type> random_test_initializer;
+        auto circuit = circuit_test_3<field_type>(
+            random_test_initializer.alg_random_engines.template get_alg_engine<field_type>(),
+            random_test_initializer.generic_random_engine);
+        keccak_runner_type test_runner(circuit);
+        BOOST_CHECK(test_runner.run_test());
+    }
+
+    BOOST_AUTO_TEST_CASE(multiple_lookup_tables_circuit) {
+        std::cout << "circuit_test_7:" << std::endl;
+        test_tools::random_test_initializer<field_type> random_test_initializer;
+        auto circuit = circuit_test_7<field_type>(
+            random_test_initializer.alg_random_engines.template get_alg_engine<field_type>(),
+            random_test_initializer.generic_random_engine);
+        poseidon_runner_type test_runner(circuit);
+        BOOST_CHECK(test_runner.run_test());
+    }
+
+    BOOST_AUTO_TEST_CASE(wide_permutation_circuit) {
+        std::cout << "circuit_test_5:" << std::endl;
+        test_tools::random_test_initializer<field_type> random_test_initializer;
+        auto circuit = circuit_test_5<field_type>(
+            random_test_initializer.alg_random_engines.template get_alg_engine<field_type>(),
+            random_test_initializer.generic_random_engine);
+        keccak_runner_type test_runner(circuit);
+        BOOST_CHECK(test_runner.run_test());
+    }
+
+    BOOST_AUTO_TEST_CASE(fibonacci_circuit) {
+        std::cout << "circuit_test_fib<" << (1 << 16) - 1 << ">:" << std::endl;
+        test_tools::random_test_initializer<field_type> random_test_initializer;
+        auto circuit = circuit_test_fib<field_type, (1 << 16) - 1>(
+            random_test_initializer.alg_random_engines.template get_alg_engine<field_type>());
+        keccak_runner_type test_runner(circuit);
+        BOOST_CHECK(test_runner.run_test());
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
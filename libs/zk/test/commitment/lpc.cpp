@@ -655,4 +655,98 @@ BOOST_AUTO_TEST_SUITE(lpc_params_test_suite)
         BOOST_CHECK(verifier_next_challenge == prover_next_challenge);
     }
 
+    BOOST_FIXTURE_TEST_CASE(lpc_duplex_sponge_transcript_test, test_fixture) {
+        // Setup types.
+        typedef algebra::curves::bls12<381> curve_type;
+        typedef typename curve_type::scalar_field_type FieldType;
+        typedef hashes::sha2<256> merkle_hash_type;
+        typedef zk::transcript::duplex_sponge<hashes::keccak_1600<256>> transcript_hash_type;
+        typedef typename containers::merkle_tree<merkle_hash_type, 2> merkle_tree_type;
+
+        constexpr static const std::size_t lambda = 10;
+        constexpr static const std::size_t k = 1;
+
+        constexpr static const std::size_t d = 16;
+        constexpr static const std::size_t r = boost::static_log2<(d - k)>::value;
+
+        constexpr static const std::size_t m = 2;
+
+        typedef zk::commitments::fri<FieldType, merkle_hash_type, transcript_hash_type, m> fri_type;
+
+        typedef zk::commitments::
+        list_polynomial_commitment_params<merkle_hash_type, transcript_hash_type, m>
+                lpc_params_type;
+        typedef zk::commitments::list_polynomial_commitment<FieldType, lpc_params_type> lpc_type;
+
+        static_assert(zk::is_commitment<fri_type>::value);
+        static_assert(zk::is_commitment<lpc_type>::value);
+        static_assert(!zk::is_commitment<merkle_hash_type>::value);
+        static_assert(!zk::is_commitment<merkle_tree_type>::value);
+        static_assert(!zk::is_commitment<std::size_t>::value);
+
+        constexpr static const std::size_t d_extended = d;
+        std::size_t extended_log = boost::static_log2<d_extended>::value;
+        std::vector<std::shared_ptr<math::evaluation_domain<FieldType>>> D =
+                math::calculate_domain_set<FieldType>(extended_log, r);
+
+        typename fri_type::params_type fri_params(
+                d - 1, // max_degree
+                D,
+                generate_random_step_list(r, 1, test_global_rnd_engine),
+                2, //expand_factor
+                lambda
+        );
+
+        using lpc_scheme_type = nil::crypto3::zk::commitments::lpc_commitment_scheme<lpc_type, math::polynomial<typename FieldType::value_type>>;
+        lpc_scheme_type lpc_scheme_prover(fri_params);
+        lpc_scheme_type lpc_scheme_verifier(fri_params);
+
+        // Generate polynomials
+        lpc_scheme_prover.append_to_batch(0, {1u, 13u, 4u, 1u, 5u, 6u, 7u, 2u, 8u, 7u, 5u, 6u, 1u, 2u, 1u, 1u});
+        lpc_scheme_prover.append_to_batch(1, {0u, 1u});
+        lpc_scheme_prover.append_to_batch(1, {0u, 1u, 2u});
+        lpc_scheme_prover.append_to_batch(1, {0u, 1u, 3u});
+        lpc_scheme_prover.append_to_batch(2, {0u});
+        lpc_scheme_prover.append_to_batch(3, generate_random_polynomial(4, test_global_alg_rnd_engine<FieldType>));
+        lpc_scheme_prover.append_to_batch(3, generate_random_polynomial(9, test_global_alg_rnd_engine<FieldType>));
+
+        // Commit
+        std::map<std::size_t, typename lpc_type::commitment_type> commitments;
+        commitments[0] = lpc_scheme_prover.commit(0);
+        commitments[1] = lpc_scheme_prover.commit(1);
+        commitments[2] = lpc_scheme_prover.commit(2);
+        commitments[3] = lpc_scheme_prover.commit(3);
+
+        // Generate evaluation points. Choose poin1ts outside the domain
+        auto point = algebra::fields::arithmetic_params<FieldType>::multiplicative_generator;
+        lpc_scheme_prover.append_eval_point(0, point);
+        lpc_scheme_prover.append_eval_point(1, point);
+        lpc_scheme_prover.append_eval_point(2, point);
+        lpc_scheme_prover.append_eval_point(3, point);
+
+        std::array<std::uint8_t, 96> x_data{};
+
+        // Prove
+        zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript(x_data);
+        auto proof = lpc_scheme_prover.proof_eval(transcript);
+
+        // Verify
+        zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript_verifier(x_data);
+        lpc_scheme_verifier.set_batch_size(0, proof.z.get_batch_size(0));
+        lpc_scheme_verifier.set_batch_size(1, proof.z.get_batch_size(1));
+        lpc_scheme_verifier.set_batch_size(2, proof.z.get_batch_size(2));
+        lpc_scheme_verifier.set_batch_size(3, proof.z.get_batch_size(3));
+
+        lpc_scheme_verifier.append_eval_point(0, point);
+        lpc_scheme_verifier.append_eval_point(1, point);
+        lpc_scheme_verifier.append_eval_point(2, point);
+        lpc_scheme_verifier.append_eval_point(3, point);
+        BOOST_CHECK(lpc_scheme_verifier.verify_eval(proof, commitments, transcript_verifier));
+
+        // Check transcript state
+        typename FieldType::value_type verifier_next_challenge = transcript_verifier.template challenge<FieldType>();
+        typename FieldType::value_type prover_next_challenge = transcript.template challenge<FieldType>();
+        BOOST_CHECK(verifier_next_challenge == prover_next_challenge);
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
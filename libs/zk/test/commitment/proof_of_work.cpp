@@ -94,4 +94,60 @@ BOOST_AUTO_TEST_SUITE(proof_of_knowledge_test_suite)
         BOOST_ASSERT(!hard_pow_type::verify(old_transcript_1, result, grinding_bits));
     }
 
+    BOOST_AUTO_TEST_CASE(pow_first_nonce_test) {
+        using keccak = nil::crypto3::hashes::keccak_1600<512>;
+        using pow_type = nil::crypto3::zk::commitments::proof_of_work<keccak, std::uint32_t>;
+        using transcript_type = nil::crypto3::zk::transcript::fiat_shamir_heuristic_sequential<keccak>;
+
+        const std::uint32_t grinding_bits = 12;
+        const std::uint32_t start_nonce = 0xFFFFF000;
+
+        transcript_type transcript;
+        auto old_transcript = transcript;
+        auto result = pow_type::generate(transcript, grinding_bits, start_nonce);
+
+        // The found nonce must be the first one accepted by the sequential search, whatever the threads count is.
+        std::uint32_t expected = start_nonce;
+        while (true) {
+            transcript_type tmp_transcript = old_transcript;
+            if (pow_type::verify(tmp_transcript, expected, grinding_bits)) {
+                break;
+            }
+            ++expected;
+        }
+        BOOST_CHECK_EQUAL(result, expected);
+
+        // The transcript is left in the same state as after the verification.
+        BOOST_CHECK(pow_type::verify(old_transcript, result, grinding_bits));
+        BOOST_CHECK_EQUAL(old_transcript.int_challenge<std::uint32_t>(), transcript.int_challenge<std::uint32_t>());
+    }
+
+    BOOST_AUTO_TEST_CASE(field_pow_first_nonce_test) {
+        using keccak = nil::crypto3::hashes::keccak_1600<256>;
+        using field_type = curves::pallas::base_field_type;
+        using pow_type = nil::crypto3::zk::commitments::field_proof_of_work<keccak, field_type>;
+        using transcript_type = nil::crypto3::zk::transcript::fiat_shamir_heuristic_sequential<keccak>;
+
+        const std::size_t grinding_bits = 8;
+        const typename field_type::value_type start_nonce = 0x1234;
+
+        transcript_type transcript;
+        auto old_transcript = transcript;
+        auto result = pow_type::generate(transcript, grinding_bits, start_nonce);
+
+        // The nonces are absorbed from a snapshot of the hash accumulator, the result must be the same.
+        typename field_type::value_type expected = start_nonce;
+        while (true) {
+            transcript_type tmp_transcript = old_transcript;
+            if (pow_type::verify(tmp_transcript, expected, grinding_bits)) {
+                break;
+            }
+            ++expected;
+        }
+        BOOST_CHECK(result == expected);
+
+        BOOST_CHECK(pow_type::verify(old_transcript, result, grinding_bits));
+        BOOST_CHECK_EQUAL(old_transcript.int_challenge<std::uint32_t>(), transcript.int_challenge<std::uint32_t>());
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -39,6 +39,7 @@
 #include <nil/crypto3/zk/math/expression.hpp>
 #include <nil/crypto3/zk/math/expression_visitors.hpp>
 #include <nil/crypto3/zk/math/expression_evaluator.hpp>
+#include <nil/crypto3/zk/math/compiled_expression.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/variable.hpp>
 
 using namespace nil::crypto3;
@@ -158,4 +159,47 @@ BOOST_AUTO_TEST_CASE(expression_for_each_variable_visitor_test) {
         expected_rotations.begin(), expected_rotations.end());
 }
 
+BOOST_AUTO_TEST_CASE(compiled_expression_evaluation_test) {
+
+    // setup
+    using curve_type = algebra::curves::pallas;
+    using FieldType = typename curve_type::base_field_type;
+    using variable_type = typename nil::crypto3::zk::snark::plonk_variable<typename FieldType::value_type>;
+
+    variable_type w0(0, 0, variable_type::column_type::witness);
+    variable_type w1(3, -1, variable_type::column_type::public_input);
+    variable_type w2(4, 1, variable_type::column_type::public_input);
+    variable_type w3(6, 2, variable_type::column_type::constant);
+
+    // (w0 + w1) and (w2 + w3) appear twice, they must be computed once.
+    expression<variable_type> expr = (w0 + w1) * (w2 + w3) + ((w0 + w1) * 5u - w1 * w2 * 2u).pow(3) * (w2 + w3);
+
+    compiled_expression<variable_type> program(expr);
+    BOOST_CHECK_EQUAL(program.variables().size(), 4);
+    BOOST_CHECK_EQUAL(program.instructions().size(), 11);
+    BOOST_CHECK(program.registers_count() < program.variables().size() + 2 + program.instructions().size());
+
+    std::vector<variable_type::assignment_type> registers = program.make_registers();
+    for (std::size_t row = 0; row < 3; ++row) {
+        std::unordered_map<variable_type, variable_type::assignment_type> values = {
+            {w0, variable_type::assignment_type(row + 1u)},
+            {w1, variable_type::assignment_type(row + 2u)},
+            {w2, variable_type::assignment_type(row + 3u)},
+            {w3, variable_type::assignment_type(row + 4u)}};
+        for (std::size_t i = 0; i < program.variables().size(); ++i) {
+            registers[i] = values[program.variables()[i]];
+        }
+
+        expression_evaluator<variable_type> evaluator(
+            expr,
+            [&values](const variable_type& var) -> const variable_type::assignment_type& {
+                return values[var];
+            }
+        );
+        BOOST_CHECK(program.evaluate(registers) == evaluator.evaluate());
+    }
+
+    BOOST_CHECK_EQUAL(program.degree([](std::size_t) { return 1; }), 7);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
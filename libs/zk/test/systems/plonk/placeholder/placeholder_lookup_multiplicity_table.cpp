@@ -0,0 +1,101 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// Test the multiplicity table used to sort lookup columns
+//
+
+#define BOOST_TEST_MODULE placeholder_lookup_multiplicity_table_test
+
+#include <map>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/lookup_multiplicity_table.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::zk::snark;
+
+BOOST_AUTO_TEST_SUITE(placeholder_lookup_multiplicity_table)
+
+    using field_type = typename algebra::curves::pallas::base_field_type;
+    using value_type = typename field_type::value_type;
+    using polynomial_dfs_type = math::polynomial_dfs<value_type>;
+
+    BOOST_AUTO_TEST_CASE(table_values_test) {
+        const std::size_t rows_amount = 6;
+        // The padding rows past rows_amount are not counted
+        std::vector<polynomial_dfs_type> table = {
+            polynomial_dfs_type(7, {1, 1, 2, 3, 3, 3, 9, 9}),
+            polynomial_dfs_type(7, {4, 5, 5, 6, 7, 8, 9, 9}),
+        };
+        detail::lookup_multiplicity_table<field_type> multiplicities(table, rows_amount);
+
+        BOOST_CHECK_EQUAL(multiplicities.count(value_type(1)), 2);
+        BOOST_CHECK_EQUAL(multiplicities.count(value_type(2)), 1);
+        BOOST_CHECK_EQUAL(multiplicities.count(value_type(3)), 3);
+        BOOST_CHECK_EQUAL(multiplicities.count(value_type(5)), 2);
+        BOOST_CHECK_EQUAL(multiplicities.count(value_type(8)), 1);
+        BOOST_CHECK_EQUAL(multiplicities.count(value_type(9)), 0);
+        BOOST_CHECK_EQUAL(multiplicities.count(value_type(10)), 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(input_values_test) {
+        const std::size_t rows_amount = 1 << 10;
+        const std::size_t table_values = 100;
+
+        std::vector<value_type> table_column(rows_amount);
+        for (std::size_t j = 0; j < rows_amount; j++) {
+            table_column[j] = value_type(j * table_values / rows_amount);
+        }
+        std::vector<polynomial_dfs_type> table = {polynomial_dfs_type(rows_amount - 1, table_column)};
+
+        std::map<std::size_t, std::size_t> expected;
+        for (std::size_t j = 0; j < rows_amount; j++) {
+            expected[j * table_values / rows_amount]++;
+        }
+
+        std::vector<polynomial_dfs_type> input;
+        for (std::size_t i = 0; i < 3; i++) {
+            std::vector<value_type> column(rows_amount);
+            for (std::size_t j = 0; j < rows_amount; j++) {
+                const std::size_t value = (j * j + 31 * i) % table_values;
+                column[j] = value_type(value);
+                expected[value]++;
+            }
+            input.emplace_back(rows_amount - 1, column);
+        }
+
+        detail::lookup_multiplicity_table<field_type> multiplicities(table, rows_amount);
+        multiplicities.add(input);
+
+        for (const auto &[value, count] : expected) {
+            BOOST_CHECK_EQUAL(multiplicities.count(value_type(value)), count);
+        }
+        BOOST_CHECK_EQUAL(multiplicities.count(value_type(table_values)), 0);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -25,6 +25,7 @@
 
 #define BOOST_TEST_MODULE zk_transcript_test
 
+#include <string>
 #include <vector>
 
 #include <boost/test/unit_test.hpp>
@@ -120,6 +121,114 @@ BOOST_AUTO_TEST_CASE(zk_poseidon_transcript_no_init_test) {
 
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_SUITE(zk_duplex_sponge_transcript_test_suite)
+
+template<typename hash_type, typename field_type>
+void test_duplex_sponge_transcript() {
+    using transcript_type = transcript::fiat_shamir_heuristic_sequential<transcript::duplex_sponge<hash_type>>;
+    using value_type = typename field_type::value_type;
+
+    std::vector<std::uint8_t> init_blob {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    transcript_type tr(init_blob);
+    tr(value_type(5u));
+
+    // Copies continue the same way, challenges() squeezes the same values as challenge() calls.
+    transcript_type copy = tr;
+    auto ch_n = tr.template challenges<field_type, 3>();
+    for (std::size_t i = 0; i < 3; i++) {
+        BOOST_CHECK(copy.template challenge<field_type>() == ch_n[i]);
+    }
+    BOOST_CHECK(ch_n[0] != ch_n[1] && ch_n[1] != ch_n[2]);
+    BOOST_CHECK_EQUAL(tr.template int_challenge<std::uint32_t>(), copy.template int_challenge<std::uint32_t>());
+
+    // Trailing zeros of the absorbed data change the challenges.
+    transcript_type padded(init_blob);
+    padded(value_type(5u));
+    padded(value_type(0u));
+    transcript_type unpadded(init_blob);
+    unpadded(value_type(5u));
+    BOOST_CHECK(padded.template challenge<field_type>() != unpadded.template challenge<field_type>());
+
+    // Absorbing after squeezing changes the following challenges.
+    transcript_type other = copy;
+    copy(value_type(7u));
+    BOOST_CHECK(copy.template challenge<field_type>() != other.template challenge<field_type>());
+}
+
+BOOST_AUTO_TEST_CASE(duplex_sponge_keccak) {
+    test_duplex_sponge_transcript<hashes::keccak_1600<256>, algebra::curves::alt_bn128_254::scalar_field_type>();
+}
+
+BOOST_AUTO_TEST_CASE(duplex_sponge_poseidon) {
+    using field_type = algebra::curves::pallas::base_field_type;
+    test_duplex_sponge_transcript<hashes::poseidon<hashes::detail::mina_poseidon_policy<field_type>>, field_type>();
+}
+
+BOOST_AUTO_TEST_CASE(duplex_sponge_keccak_known_answer) {
+    // Absorbing a message and squeezing is Keccak-256 of the message, extended to longer outputs by further
+    // permutations. The 200 byte message and output cross the rate of 136 bytes both ways.
+    const auto squeezed = [](const std::vector<std::uint8_t> &message, std::size_t length) {
+        transcript::detail::keccak_duplex_sponge<256> sponge;
+        sponge.absorb_bytes(message.begin(), message.end());
+        std::string result;
+        for (std::size_t i = 0; i < length; i++) {
+            const std::uint8_t byte = sponge.squeeze_byte();
+            result.push_back("0123456789abcdef"[byte >> 4]);
+            result.push_back("0123456789abcdef"[byte & 0x0f]);
+        }
+        return result;
+    };
+
+    BOOST_CHECK_EQUAL(squeezed({}, 32), "c5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470");
+    BOOST_CHECK_EQUAL(squeezed({'a', 'b', 'c'}, 32),
+                      "4e03657aea45a94fc7d47ba826c8d667c0d1e6e33a64a036ec44f58fa12d6c45");
+
+    std::vector<std::uint8_t> message(200);
+    for (std::size_t i = 0; i < message.size(); i++) {
+        message[i] = static_cast<std::uint8_t>(i);
+    }
+    BOOST_CHECK_EQUAL(
+        squeezed(message, 200),
+        "bfb0aa97863e797943cf7c33bb7e880bb4543f3d2703c0923c6901c2af57b89064364091dea65596abf41a5c810bdd09"
+        "b28414c196cb749ab6cd7dee1f782613346bfbf7cc2a7a53358e7ba8323b4fcb23173f46d271fa4f2d177e9f11b4c42d"
+        "a71925b50b95beb8b6f43c38360821ea73a3870aa87fda14be73914e5228126127d8ca45f73ae92e3c9719f320502d56"
+        "6e1f2453d919d2bcd3b6a7e42547c370e92909064a6d38c36888feaffd3d4de00d57fdde1e7ab8440ba6b47f30c9e157"
+        "f37b23e0490ba3d9");
+}
+
+BOOST_AUTO_TEST_CASE(duplex_sponge_poseidon_bytes) {
+    using field_type = algebra::curves::pallas::base_field_type;
+    using transcript_type = transcript::fiat_shamir_heuristic_sequential<
+        transcript::duplex_sponge<hashes::poseidon<hashes::detail::mina_poseidon_policy<field_type>>>>;
+
+    // Byte strings differing only in leading zeros pack into the same elements, their lengths differ.
+    transcript_type tr1(std::vector<std::uint8_t> {0x00, 0x01});
+    transcript_type tr2(std::vector<std::uint8_t> {0x01});
+    transcript_type tr3(std::vector<std::uint8_t> {0x01});
+    auto ch2 = tr2.challenge<field_type>();
+    BOOST_CHECK(ch2 == tr3.challenge<field_type>());
+    BOOST_CHECK(ch2 != tr1.challenge<field_type>());
+}
+
+BOOST_AUTO_TEST_CASE(duplex_sponge_keccak_curve_element) {
+    using curve_type = algebra::curves::bls12_381;
+    using field_type = typename curve_type::scalar_field_type;
+    using transcript_type =
+        transcript::fiat_shamir_heuristic_sequential<transcript::duplex_sponge<hashes::keccak_1600<256>>>;
+
+    // A point is absorbed by its affine coordinates, so the representation does not matter.
+    transcript_type tr1, tr2, tr3;
+    tr1(curve_type::g1_type<>::value_type::one());
+    tr2(curve_type::g1_type<>::value_type::one() * field_type::value_type(2u));
+    tr3(curve_type::g1_type<>::value_type::one() + curve_type::g1_type<>::value_type::one());
+    tr1(curve_type::g2_type<>::value_type::one());
+    auto ch2 = tr2.challenge<field_type>();
+    BOOST_CHECK(ch2 == tr3.challenge<field_type>());
+    BOOST_CHECK(ch2 != tr1.challenge<field_type>());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 /* TODO: Write more elaborate tests for transcript of curve elements */
 BOOST_AUTO_TEST_SUITE(transcript_test_curves)
 